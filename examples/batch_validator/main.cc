@@ -0,0 +1,186 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+// Validates XML files against an XSD schema, a RelaxNG schema or a DTD,
+// with a BatchValidator, which spreads the files over several threads.
+// Prints the result of each file, and the throughput.
+//
+// Usage: example [-j number-of-threads] schema-file xml-file...
+// The type of the schema is given by the extension of the schema file:
+// .xsd, .rng or .dtd. The default number of threads is the number of
+// hardware threads.
+// Without arguments, validates generated documents in memory.
+//
+// Exit status: 0 if all files are valid, 1 if some file is not valid or
+// can't be read, 2 if the arguments or the schema are wrong.
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <libxml++/libxml++.h>
+
+namespace
+{
+int usage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [-j number-of-threads] schema-file xml-file..." << std::endl;
+  return 2;
+}
+
+bool has_extension(const std::string& filename, const char* extension)
+{
+  const auto length = std::strlen(extension);
+  return filename.size() > length &&
+    filename.compare(filename.size() - length, length, extension) == 0;
+}
+
+std::unique_ptr<xmlpp::BatchValidator> make_validator(const std::string& filename,
+  unsigned int n_threads)
+{
+  if (has_extension(filename, ".xsd"))
+    return std::make_unique<xmlpp::BatchValidator>(
+      std::make_shared<const xmlpp::XsdSchema>(filename), n_threads);
+  if (has_extension(filename, ".rng"))
+    return std::make_unique<xmlpp::BatchValidator>(
+      std::make_shared<const xmlpp::RelaxNGSchema>(filename), n_threads);
+  if (has_extension(filename, ".dtd"))
+    return std::make_unique<xmlpp::BatchValidator>(
+      std::make_shared<const xmlpp::Dtd>(filename), n_threads);
+  return nullptr;
+}
+
+const char* status_name(xmlpp::BatchValidator::Result::Status status)
+{
+  using Status = xmlpp::BatchValidator::Result::Status;
+  switch (status)
+  {
+  case Status::VALID:
+    return "valid";
+  case Status::INVALID:
+    return "invalid";
+  case Status::PARSE_ERROR:
+    return "parse error";
+  default:
+    return "error";
+  }
+}
+
+void print_rate(std::size_t n_documents, unsigned int n_threads, double seconds)
+{
+  std::cout << "Validated " << n_documents << " documents on " << n_threads
+    << " threads in " << static_cast<long>(seconds * 1000.0) << " ms";
+  if (seconds > 0.0)
+    std::cout << ", " << static_cast<long>(n_documents / seconds) << " documents/s";
+  std::cout << std::endl;
+}
+
+// Validates generated documents in memory against a generated XSD schema.
+int run_demo()
+{
+  auto schema = std::make_shared<xmlpp::XsdSchema>();
+  schema->parse_memory(
+    "<xs:schema xmlns:xs=\"http://www.w3.org/2001/XMLSchema\">"
+    "<xs:element name=\"orders\"><xs:complexType><xs:sequence>"
+    "<xs:element name=\"order\" maxOccurs=\"unbounded\"><xs:complexType><xs:sequence>"
+    "<xs:element name=\"item\" type=\"xs:string\"/>"
+    "<xs:element name=\"quantity\" type=\"xs:positiveInteger\"/>"
+    "</xs:sequence><xs:attribute name=\"id\" type=\"xs:ID\" use=\"required\"/>"
+    "</xs:complexType></xs:element>"
+    "</xs:sequence></xs:complexType></xs:element>"
+    "</xs:schema>");
+
+  std::vector<std::string> documents;
+  for (int n = 0; n < 2000; ++n)
+  {
+    std::string doc = "<orders>";
+    for (int i = 0; i < 20; ++i)
+      doc += "<order id=\"o" + std::to_string(i) + "\"><item>Item " + std::to_string(n) +
+        "</item><quantity>" + std::to_string(i + 1) + "</quantity></order>";
+    doc += "</orders>";
+    documents.push_back(std::move(doc));
+  }
+
+  xmlpp::BatchValidator validator(std::move(schema));
+  const auto start = std::chrono::steady_clock::now();
+  const auto results = validator.validate_memory(documents);
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::size_t n_valid = 0;
+  for (const auto& result : results)
+    if (result)
+      ++n_valid;
+  std::cout << n_valid << " of " << results.size() << " generated documents are valid." << std::endl;
+  print_rate(results.size(), validator.get_n_threads(), elapsed.count());
+  return n_valid == results.size() ? EXIT_SUCCESS : 1;
+}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  unsigned int n_threads = 0;
+  int arg = 1;
+  if (arg < argc && std::strcmp(argv[arg], "-j") == 0)
+  {
+    if (arg + 1 >= argc || std::atoi(argv[arg + 1]) <= 0)
+      return usage(argv[0]);
+    n_threads = std::atoi(argv[arg + 1]);
+    arg += 2;
+  }
+
+  try
+  {
+    if (arg == argc && arg == 1)
+      return run_demo();
+    if (argc - arg < 2)
+      return usage(argv[0]);
+
+    const std::string schema_filename = argv[arg++];
+    const auto validator = make_validator(schema_filename, n_threads);
+    if (!validator)
+    {
+      std::cerr << schema_filename << ": unknown schema type, expected .xsd, .rng or .dtd" << std::endl;
+      return 2;
+    }
+
+    const std::vector<std::string> filenames(argv + arg, argv + argc);
+    const auto start = std::chrono::steady_clock::now();
+    const auto results = validator->validate_files(filenames);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::size_t n_valid = 0;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      std::cout << filenames[i] << ": " << status_name(results[i].status) << std::endl;
+      if (results[i])
+        ++n_valid;
+      else
+        std::cout << results[i].message << std::endl;
+    }
+    std::cout << n_valid << " of " << results.size() << " files are valid." << std::endl;
+    print_rate(results.size(), validator->get_n_threads(), elapsed.count());
+    return n_valid == results.size() ? EXIT_SUCCESS : 1;
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return 2;
+  }
+}
@@ -0,0 +1,160 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Compares parse_file() with parse_mapped_file(), and a TextReader
+// reading a file with one reading a MappedFile.
+//
+// Usage: example [file.xml]
+// Without a file name, a test file is generated in the temporary directory.
+// Give a large file to get meaningful numbers. The peak resident set size is
+// shown where it's available. It's a high-water mark for the whole process,
+// so run the program once per method for exact memory figures.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <libxml++/libxml++.h>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+class CountingParser : public xmlpp::SaxViewParser
+{
+public:
+  long n_elements = 0;
+
+protected:
+  void on_start_element_view(std::string_view, const AttributeViewList&) override
+  {
+    ++n_elements;
+  }
+};
+
+long peak_rss_kib()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return usage.ru_maxrss;
+#endif
+  return -1;
+}
+
+void measure(const std::string& title, const std::function<long()>& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  const auto count = func();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << title << ": " << count << " elements, " << elapsed.count() << " ms";
+  const auto rss = peak_rss_kib();
+  if (rss >= 0)
+    std::cout << ", peak RSS " << rss << " KiB";
+  std::cout << std::endl;
+}
+
+long sax_parse(const std::string& filepath, bool mapped)
+{
+  CountingParser parser;
+  parser.set_string_view_callbacks();
+  if (mapped)
+    parser.parse_mapped_file(filepath);
+  else
+    parser.parse_file(filepath);
+  return parser.n_elements;
+}
+
+long dom_parse(const std::string& filepath, bool mapped)
+{
+  xmlpp::DomParser parser;
+  if (mapped)
+    parser.parse_mapped_file(filepath);
+  else
+    parser.parse_file(filepath);
+  return static_cast<long>(parser.get_document()->get_root_node()->get_children().size());
+}
+
+long text_read(xmlpp::TextReader& reader)
+{
+  long n_elements = 0;
+  while (reader.read())
+    if (reader.get_node_type() == xmlpp::TextReader::NodeType::Element)
+      ++n_elements;
+  return n_elements;
+}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  std::string filepath;
+  bool remove_file = false;
+  if (argc > 1)
+    filepath = argv[1];
+  else
+  {
+    filepath = (std::filesystem::temp_directory_path() / "libxmlpp_mapped_file_example.xml").string();
+    std::ofstream out(filepath);
+    out << "<records>\n";
+    for (int i = 0; i < 20000; ++i)
+      out << "  <record id=\"" << i << "\"><name>Record " << i << "</name></record>\n";
+    out << "</records>\n";
+    if (!out)
+    {
+      std::cerr << "Could not write " << filepath << std::endl;
+      return EXIT_FAILURE;
+    }
+    remove_file = true;
+  }
+
+  auto return_code = EXIT_SUCCESS;
+  try
+  {
+    measure("SaxParser::parse_mapped_file()", [&]{ return sax_parse(filepath, true); });
+    measure("SaxParser::parse_file()       ", [&]{ return sax_parse(filepath, false); });
+    measure("DomParser::parse_mapped_file()", [&]{ return dom_parse(filepath, true); });
+    measure("DomParser::parse_file()       ", [&]{ return dom_parse(filepath, false); });
+    measure("TextReader(MappedFile&&)      ", [&]
+    {
+      xmlpp::TextReader reader(xmlpp::MappedFile{filepath});
+      return text_read(reader);
+    });
+    measure("TextReader(filename)          ", [&]
+    {
+      xmlpp::TextReader reader(filepath);
+      return text_read(reader);
+    });
+  }
+  catch (const xmlpp::exception& ex)
+  {
+    std::cerr << "libxml++ exception: " << ex.what() << std::endl;
+    return_code = EXIT_FAILURE;
+  }
+
+  if (remove_file)
+    std::remove(filepath.c_str());
+
+  return return_code;
+}
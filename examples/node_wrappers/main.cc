@@ -0,0 +1,146 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Parses a large document, visits all of its nodes and attributes, first with
+// NodeRef, which creates no C++ wrappers, then with Node, which creates a C++
+// wrapper for each of them, and destroys the document.
+// Shows the time of each step, and of all steps together.
+// Then compares the time of parsing with DomParser to parsing with libxml2
+// and adopting the xmlDoc with xmlpp::Document, which searches the nodes for
+// existing C++ wrappers.
+//
+// Usage: example [number-of-records]
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <libxml++/libxml++.h>
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+
+namespace
+{
+std::string make_document(int n_records)
+{
+  std::string doc = "<records>\n";
+  for (int i = 0; i < n_records; ++i)
+    doc += "  <record id=\"" + std::to_string(i) + "\" type=\"t" + std::to_string(i % 7) +
+      "\"><name>Record " + std::to_string(i) + "</name><value>" + std::to_string(i * 3) +
+      "</value><!-- comment --></record>\n";
+  doc += "</records>\n";
+  return doc;
+}
+
+long visit(const xmlpp::Node* node)
+{
+  long n_nodes = 1;
+  if (auto element = dynamic_cast<const xmlpp::Element*>(node))
+    n_nodes += static_cast<long>(element->get_attributes().size());
+  for (const auto child : node->children())
+    n_nodes += visit(child);
+  return n_nodes;
+}
+
+long visit(xmlpp::NodeRef node)
+{
+  long n_nodes = 1;
+  if (node.is_element())
+    for (auto attr = node.cobj()->properties; attr; attr = attr->next)
+      ++n_nodes;
+  for (auto child = node.get_first_child(); child; child = child.get_next_sibling())
+    n_nodes += visit(child);
+  return n_nodes;
+}
+
+double measure(const std::string& title, const std::function<long()>& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  const auto n_nodes = func();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << title << ": ";
+  if (n_nodes)
+    std::cout << n_nodes << " nodes, ";
+  std::cout << static_cast<long>(elapsed.count()) << " ms" << std::endl;
+  return elapsed.count();
+}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  const int n_records = argc > 1 ? std::atoi(argv[1]) : 100000;
+  if (n_records <= 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [number-of-records]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const auto document = make_document(n_records);
+
+  try
+  {
+    auto parser = std::make_unique<xmlpp::DomParser>();
+    double total = measure("Parse with DomParser", [&]
+    {
+      parser->parse_memory(document);
+      return 0L;
+    });
+
+    const auto root_ref = parser->get_document()->get_root_node_ref();
+    total += measure("Traversal with NodeRef, creates no wrappers", [&] { return visit(root_ref); });
+
+    const xmlpp::Node* root = parser->get_document()->get_root_node();
+    total += measure("First traversal, creates wrappers", [&] { return visit(root); });
+    total += measure("Second traversal, reuses wrappers", [&] { return visit(root); });
+
+    total += measure("Destroy the document", [&]
+    {
+      parser.reset();
+      return 0L;
+    });
+    std::cout << "Total: " << static_cast<long>(total) << " ms" << std::endl;
+
+    xmlDoc* cdoc = nullptr;
+    measure("Parse with libxml2", [&]
+    {
+      cdoc = xmlReadMemory(document.data(), static_cast<int>(document.size()),
+        nullptr, nullptr, 0);
+      return 0L;
+    });
+    if (!cdoc)
+    {
+      std::cerr << "xmlReadMemory() failed." << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::unique_ptr<xmlpp::Document> adopted;
+    measure("Adopt the xmlDoc with xmlpp::Document, searches for wrappers", [&]
+    {
+      adopted = std::make_unique<xmlpp::Document>(cdoc);
+      return 0L;
+    });
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Parses many small documents with a new DomParser per document, with one
+// DomParser that reuses its parser context, and with ParserPool::parse_all()
+// on 1, 2, 4, ... threads, and shows the throughput.
+//
+// Usage: example [number-of-documents [max-number-of-threads]]
+// The default maximum number of threads is the number of hardware threads,
+// at most 64.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <libxml++/libxml++.h>
+
+namespace
+{
+std::string make_document(int n)
+{
+  std::string doc = "<order id=\"" + std::to_string(n) + "\">\n";
+  for (int i = 0; i < 20; ++i)
+    doc += "  <item sku=\"" + std::to_string(n * 100 + i) + "\" quantity=\"" +
+      std::to_string(i % 5 + 1) + "\"><name>Item " + std::to_string(i) + "</name></item>\n";
+  doc += "</order>\n";
+  return doc;
+}
+
+long count_items(xmlpp::DomParser& parser)
+{
+  return static_cast<long>(parser.get_document()->get_root_node()->get_children("item").size());
+}
+
+// Returns documents per second.
+double measure(const std::string& title, std::size_t n_documents,
+  const std::function<long()>& func, double baseline = 0.0)
+{
+  const auto start = std::chrono::steady_clock::now();
+  const auto n_items = func();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  const double rate = n_documents / elapsed.count();
+
+  std::cout << title << ": " << n_items << " items, "
+    << static_cast<long>(rate) << " documents/s";
+  if (baseline > 0.0)
+    std::cout << ", speedup " << rate / baseline;
+  std::cout << std::endl;
+  return rate;
+}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  const int n_documents = argc > 1 ? std::atoi(argv[1]) : 2000;
+  unsigned int max_threads = argc > 2 ? std::atoi(argv[2]) :
+    std::min(64u, std::max(1u, std::thread::hardware_concurrency()));
+  if (n_documents <= 0 || max_threads == 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [number-of-documents [max-number-of-threads]]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> documents;
+  for (int n = 0; n < n_documents; ++n)
+    documents.push_back(make_document(n));
+
+  try
+  {
+    measure("New DomParser per document", documents.size(), [&]
+    {
+      long n_items = 0;
+      for (const auto& document : documents)
+      {
+        xmlpp::DomParser parser;
+        parser.parse_memory(document);
+        n_items += count_items(parser);
+      }
+      return n_items;
+    });
+
+    measure("One DomParser, reused context", documents.size(), [&]
+    {
+      long n_items = 0;
+      xmlpp::DomParser parser;
+      parser.set_reuse_context();
+      for (const auto& document : documents)
+      {
+        parser.parse_memory(document);
+        n_items += count_items(parser);
+      }
+      return n_items;
+    });
+
+    double baseline = 0.0;
+    for (unsigned int n_threads = 1; ; n_threads = std::min(2 * n_threads, max_threads))
+    {
+      xmlpp::ParserPool<xmlpp::DomParser> pool(n_threads);
+      // Start the threads before measuring.
+      pool.parse_all(std::vector<std::string>(n_threads, documents[0]),
+        [](std::size_t, xmlpp::DomParser&) {});
+
+      const auto rate = measure("ParserPool::parse_all(), " + std::to_string(n_threads) + " threads",
+        documents.size(), [&]
+      {
+        std::atomic<long> n_items(0);
+        const auto errors = pool.parse_all(documents,
+          [&n_items](std::size_t, xmlpp::DomParser& parser)
+          {
+            n_items += count_items(parser);
+          });
+        for (const auto& error : errors)
+          if (error)
+            std::rethrow_exception(error);
+        return n_items.load();
+      }, baseline);
+      if (n_threads == 1)
+        baseline = rate;
+
+      if (n_threads == max_threads)
+        break;
+    }
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
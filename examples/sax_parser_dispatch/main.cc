@@ -0,0 +1,141 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Compares a SaxParser with a chain of string comparisons in on_start_element()
+// with a SaxDispatchParser, which looks up each element name in a table.
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <libxml++/libxml++.h>
+
+namespace
+{
+constexpr std::size_t n_names = 64;
+
+std::string element_name(std::size_t i)
+{
+  return "element" + std::to_string(i);
+}
+
+const std::array<std::string, n_names>& element_names()
+{
+  static const auto names = []
+  {
+    std::array<std::string, n_names> result;
+    for (std::size_t i = 0; i < n_names; ++i)
+      result[i] = element_name(i);
+    return result;
+  }();
+  return names;
+}
+
+using Counts = std::array<long, n_names>;
+
+// What a hand-written if/else chain does: compare the name with
+// each known name until one matches.
+class ChainParser : public xmlpp::SaxParser
+{
+public:
+  Counts counts{};
+
+protected:
+  void on_start_element(const xmlpp::ustring& name, const AttributeList& /* attributes */) override
+  {
+    const auto& names = element_names();
+    for (std::size_t i = 0; i < n_names; ++i)
+      if (name == names[i])
+      {
+        ++counts[i];
+        break;
+      }
+  }
+};
+
+class DispatchParser : public xmlpp::SaxDispatchParser<DispatchParser>
+{
+public:
+  DispatchParser()
+  : DispatchParser(std::make_index_sequence<n_names>())
+  {}
+
+  Counts counts{};
+
+protected:
+  template <std::size_t I>
+  void on_start(const QName& /* name */, const NsAttributeList& /* attributes */)
+  {
+    ++counts[I];
+  }
+
+private:
+  template <std::size_t... I>
+  explicit DispatchParser(std::index_sequence<I...>)
+  : SaxDispatchParser({ Handler{ element_names()[I], &DispatchParser::on_start<I>, nullptr }... })
+  {}
+};
+
+template <typename T_Parser>
+double time_parse(T_Parser& parser, const std::string& document)
+{
+  const auto start = std::chrono::steady_clock::now();
+  parser.parse_memory(document);
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  // The number of elements may be given on the command line.
+  const long n_elements = argc > 1 ? std::atol(argv[1]) : 20000;
+
+  std::string document = "<root>";
+  for (long i = 0; i < n_elements; ++i)
+    document += "<" + element_name(i % n_names) + " id=\"" + std::to_string(i) + "\"/>";
+  document += "</root>";
+
+  try
+  {
+    ChainParser chain_parser;
+    const auto chain_ms = time_parse(chain_parser, document);
+
+    DispatchParser dispatch_parser;
+    const auto dispatch_ms = time_parse(dispatch_parser, document);
+
+    if (chain_parser.counts != dispatch_parser.counts)
+    {
+      std::cerr << "The parsers found different elements." << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << n_elements << " elements, " << n_names << " element names" << std::endl
+              << "if/else chain:  " << chain_ms << " ms" << std::endl
+              << "dispatch table: " << dispatch_ms << " ms" << std::endl;
+  }
+  catch (const xmlpp::exception& ex)
+  {
+    std::cerr << "libxml++ exception: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Processes a large feed one entry at a time with a SaxSubtreeParser, which
+// builds a small Document of each entry and discards everything else, and
+// compares it with building the whole document with the DOM parser.
+// Both use XPath on each entry. Shows the time of each step.
+//
+// Usage: example [number-of-entries]
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <libxml++/libxml++.h>
+
+namespace
+{
+std::string make_feed(int n_entries)
+{
+  std::string feed = "<feed xmlns=\"urn:feed\">\n";
+  for (int i = 0; i < n_entries; ++i)
+    feed += std::string("  <entry type=\"") + (i % 3 == 0 ? "x" : "y") + "\"><id>" +
+      std::to_string(i) + "</id><title>Entry " + std::to_string(i) + "</title>"
+      "<author><name>Author " + std::to_string(i % 10) + "</name></author></entry>\n";
+  feed += "</feed>\n";
+  return feed;
+}
+
+void measure(const std::string& title, const std::function<double()>& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  const auto sum = func();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << title << ": sum of ids " << sum << ", "
+    << static_cast<long>(elapsed.count()) << " ms" << std::endl;
+}
+
+const xmlpp::Node::PrefixNsMap namespaces = { { "f", "urn:feed" } };
+
+// Adds the ids of the entries of type x.
+class EntryParser : public xmlpp::SaxSubtreeParser
+{
+public:
+  EntryParser()
+  : SaxSubtreeParser("/f:feed/f:entry", namespaces),
+    is_selected_("@type = 'x'"), id_("f:id")
+  {}
+
+  double sum = 0;
+
+protected:
+  void on_subtree(std::unique_ptr<xmlpp::Document> document) override
+  {
+    const auto entry = document->get_root_node();
+    if (entry->eval_to_boolean(is_selected_, context_))
+      sum += entry->eval_to_number(id_, context_);
+  }
+
+private:
+  const xmlpp::XPathExpression is_selected_;
+  const xmlpp::XPathExpression id_;
+  xmlpp::XPathContext context_{namespaces};
+};
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  const int n_entries = argc > 1 ? std::atoi(argv[1]) : 100000;
+  if (n_entries <= 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [number-of-entries]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    const auto feed = make_feed(n_entries);
+
+    measure("DomParser", [&]
+    {
+      xmlpp::DomParser parser;
+      parser.parse_memory(feed);
+      const xmlpp::XPathExpression entries("/f:feed/f:entry[@type = 'x']");
+      const xmlpp::XPathExpression id("f:id");
+      xmlpp::XPathContext context(namespaces);
+      double sum = 0;
+      for (auto entry : parser.get_document()->get_root_node()->find(entries, context))
+        sum += entry->eval_to_number(id, context);
+      return sum;
+    });
+
+    measure("SaxSubtreeParser", [&]
+    {
+      EntryParser parser;
+      parser.parse_memory(feed);
+      return parser.sum;
+    });
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,194 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Validates many documents against one XSD schema from 1, 2, 4, ... threads.
+// Compares a SharedSchemaValidator, which shares one compiled schema and keeps
+// a validation context per thread, with one XsdValidator shared by all threads
+// behind a mutex, and with an XsdValidator per thread, which parses the schema
+// in each thread. Shows the time of parsing the schema, and the throughput.
+//
+// Usage: example [number-of-documents [max-number-of-threads]]
+// The default maximum number of threads is the number of hardware threads,
+// at most 64.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <libxml++/libxml++.h>
+
+namespace
+{
+const int n_types = 1000;
+
+// A schema with many types, which takes some time to parse and compile.
+std::string make_schema()
+{
+  std::string xsd = "<xs:schema xmlns:xs=\"http://www.w3.org/2001/XMLSchema\">\n";
+  for (int t = 0; t < n_types; ++t)
+  {
+    const auto name = "record" + std::to_string(t);
+    xsd += "<xs:complexType name=\"" + name + "Type\"><xs:sequence>"
+      "<xs:element name=\"id\" type=\"xs:positiveInteger\"/>"
+      "<xs:element name=\"name\" type=\"xs:string\"/>"
+      "<xs:element name=\"price\" type=\"xs:decimal\" minOccurs=\"0\"/>"
+      "<xs:choice maxOccurs=\"unbounded\">"
+      "<xs:element name=\"tag\" type=\"xs:token\"/>"
+      "<xs:element name=\"note\" type=\"xs:string\"/>"
+      "</xs:choice></xs:sequence>"
+      "<xs:attribute name=\"status\"><xs:simpleType><xs:restriction base=\"xs:string\">"
+      "<xs:enumeration value=\"active\"/><xs:enumeration value=\"retired\"/>"
+      "</xs:restriction></xs:simpleType></xs:attribute>"
+      "</xs:complexType>\n";
+  }
+  xsd += "<xs:element name=\"catalog\"><xs:complexType><xs:choice maxOccurs=\"unbounded\">\n";
+  for (int t = 0; t < n_types; ++t)
+  {
+    const auto name = "record" + std::to_string(t);
+    xsd += "<xs:element name=\"" + name + "\" type=\"" + name + "Type\"/>\n";
+  }
+  xsd += "</xs:choice></xs:complexType></xs:element>\n</xs:schema>\n";
+  return xsd;
+}
+
+std::string make_document(int n)
+{
+  std::string doc = "<catalog>\n";
+  for (int i = 0; i < 50; ++i)
+  {
+    const auto name = "record" + std::to_string((n + i * 7) % n_types);
+    doc += "  <" + name + " status=\"active\"><id>" + std::to_string(n * 100 + i + 1) +
+      "</id><name>Item " + std::to_string(i) + "</name><price>" + std::to_string(i) +
+      ".95</price><tag>a</tag><note>text</note><tag>b</tag></" + name + ">\n";
+  }
+  doc += "</catalog>\n";
+  return doc;
+}
+
+// Runs func(thread, n_threads) on n_threads threads, and returns
+// the elapsed time in seconds.
+double run_threads(unsigned int n_threads, const std::function<void(unsigned int, unsigned int)>& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < n_threads; ++t)
+    threads.emplace_back(func, t, n_threads);
+  for (auto& thread : threads)
+    thread.join();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+void print_rate(const std::string& title, std::size_t n_documents, double seconds, double baseline = 0.0)
+{
+  const double rate = n_documents / seconds;
+  std::cout << title << ": " << static_cast<long>(rate) << " documents/s";
+  if (baseline > 0.0)
+    std::cout << ", speedup " << rate / baseline;
+  std::cout << std::endl;
+}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  const int n_documents = argc > 1 ? std::atoi(argv[1]) : 1000;
+  unsigned int max_threads = argc > 2 ? std::atoi(argv[2]) :
+    std::min(64u, std::max(1u, std::thread::hardware_concurrency()));
+  if (n_documents <= 0 || max_threads == 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [number-of-documents [max-number-of-threads]]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    const auto schema_text = make_schema();
+    std::vector<std::unique_ptr<xmlpp::DomParser>> parsers;
+    for (int n = 0; n < n_documents; ++n)
+    {
+      parsers.push_back(std::make_unique<xmlpp::DomParser>());
+      parsers.back()->parse_memory(make_document(n));
+    }
+    const auto document = [&parsers](std::size_t n) { return parsers[n]->get_document(); };
+
+    auto start = std::chrono::steady_clock::now();
+    auto schema = std::make_shared<xmlpp::XsdSchema>();
+    schema->parse_memory(schema_text);
+    const std::chrono::duration<double> parse_time = std::chrono::steady_clock::now() - start;
+    std::cout << "Parsing the schema (" << n_types << " types): "
+      << static_cast<long>(parse_time.count() * 1000.0) << " ms" << std::endl;
+
+    const xmlpp::SharedSchemaValidator shared_validator(schema);
+    xmlpp::XsdValidator locked_validator(schema.get(), false);
+    std::mutex mutex;
+
+    double baseline = 0.0;
+    for (unsigned int n_threads = 1; ; n_threads = std::min(2 * n_threads, max_threads))
+    {
+      const auto threads = ", " + std::to_string(n_threads) + " threads";
+
+      auto seconds = run_threads(n_threads, [&](unsigned int t, unsigned int stride)
+      {
+        for (std::size_t n = t; n < parsers.size(); n += stride)
+          shared_validator.validate(document(n));
+      });
+      print_rate("SharedSchemaValidator" + threads, parsers.size(), seconds, baseline);
+      if (n_threads == 1)
+        baseline = parsers.size() / seconds;
+
+      seconds = run_threads(n_threads, [&](unsigned int t, unsigned int stride)
+      {
+        for (std::size_t n = t; n < parsers.size(); n += stride)
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          locked_validator.validate(document(n));
+        }
+      });
+      print_rate("One XsdValidator with a mutex" + threads, parsers.size(), seconds, baseline);
+
+      seconds = run_threads(n_threads, [&](unsigned int t, unsigned int stride)
+      {
+        xmlpp::XsdValidator validator;
+        validator.parse_memory(schema_text);
+        for (std::size_t n = t; n < parsers.size(); n += stride)
+          validator.validate(document(n));
+      });
+      print_rate("An XsdValidator per thread, parsing the schema" + threads,
+        parsers.size(), seconds, baseline);
+
+      if (n_threads == max_threads)
+        break;
+    }
+    std::cout << "Validation contexts of the SharedSchemaValidator: "
+      << shared_validator.get_n_contexts() << std::endl;
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Evaluates the same XPath expressions with each record of a large document,
+// first from strings, which are compiled by each call, then with compiled
+// XPathExpressions and a reused XPathContext. Then compares find() with
+// count(), exists() and select(), which create no C++ wrappers.
+// Shows the time of each step.
+//
+// Usage: example [number-of-records]
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <libxml++/libxml++.h>
+
+namespace
+{
+std::string make_document(int n_records)
+{
+  std::string doc = "<records xmlns:r=\"urn:records\">\n";
+  for (int i = 0; i < n_records; ++i)
+    doc += "  <record id=\"" + std::to_string(i) + "\"><name>Record " + std::to_string(i) +
+      "</name><r:value>" + std::to_string(i % 100) + "</r:value></record>\n";
+  doc += "</records>\n";
+  return doc;
+}
+
+void measure(const std::string& title, const std::function<double()>& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  const auto sum = func();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << title << ": sum " << sum << ", "
+    << static_cast<long>(elapsed.count()) << " ms" << std::endl;
+}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  const int n_records = argc > 1 ? std::atoi(argv[1]) : 20000;
+  if (n_records <= 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [number-of-records]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    xmlpp::DomParser parser;
+    parser.parse_memory(make_document(n_records));
+    const xmlpp::Node* root = parser.get_document()->get_root_node();
+    const xmlpp::Node::PrefixNsMap namespaces = { { "r", "urn:records" } };
+
+    measure("Strings", [&]
+    {
+      double sum = 0;
+      for (auto record : root->child_elements("record"))
+      {
+        sum += record->find("name").size();
+        sum += record->eval_to_number("r:value * 2", namespaces);
+      }
+      return sum;
+    });
+
+    measure("Compiled expressions", [&]
+    {
+      const xmlpp::XPathExpression name("name");
+      const xmlpp::XPathExpression value("r:value * 2");
+      xmlpp::XPathContext context(namespaces);
+      double sum = 0;
+      for (auto record : root->child_elements("record"))
+      {
+        sum += record->find(name, context).size();
+        sum += record->eval_to_number(value, context);
+      }
+      return sum;
+    });
+
+    const xmlpp::XPathExpression high_values("//record[r:value > 50]");
+    xmlpp::XPathContext context(namespaces);
+    measure("count()", [&] { return root->count(high_values, context); });
+    measure("exists()", [&] { return root->exists(high_values, context); });
+    measure("find_first()", [&] { return root->find_first(high_values, context) != nullptr; });
+    measure("find().size()", [&] { return root->find(high_values, context).size(); });
+
+    // The r:value elements have no C++ wrappers yet. select() doesn't create
+    // them, when the nodes are accessed as NodeRefs. find() creates them all.
+    const xmlpp::XPathExpression values("//r:value");
+    measure("select() with NodeRefs", [&]
+    {
+      double sum = 0;
+      for (auto value : xmlpp::XPathNodeSet<xmlpp::NodeRef>(root->select(values, context)))
+        sum += std::stod(std::string(value.get_first_child().get_content_view()));
+      return sum;
+    });
+    measure("find()", [&]
+    {
+      double sum = 0;
+      for (auto value : root->find(values, context))
+        sum += std::stod(static_cast<const xmlpp::Element*>(value)->get_first_child_text()->get_content2().value_or(""));
+      return sum;
+    });
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
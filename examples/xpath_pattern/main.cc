@@ -0,0 +1,155 @@
+/* main.cc
+ *
+ * Copyright (C) 2026 The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Extracts the ids of some entries of a large feed, as
+// find("/feed/entry[@type='x']/id") would do, first with the DOM parser and
+// find(), then without building the document, with a SaxViewParser and with a
+// TextReader that match streamable patterns. Shows the time of each step.
+//
+// Usage: example [number-of-entries]
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <libxml++/libxml++.h>
+
+namespace
+{
+std::string make_feed(int n_entries)
+{
+  std::string feed = "<feed>\n";
+  for (int i = 0; i < n_entries; ++i)
+    feed += std::string("  <entry type=\"") + (i % 3 == 0 ? "x" : "y") + "\"><id>" +
+      std::to_string(i) + "</id><title>Entry " + std::to_string(i) + "</title></entry>\n";
+  feed += "</feed>\n";
+  return feed;
+}
+
+void measure(const std::string& title, const std::function<long()>& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  const auto sum = func();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << title << ": sum of ids " << sum << ", "
+    << static_cast<long>(elapsed.count()) << " ms" << std::endl;
+}
+
+// Adds the ids of the entries of type x.
+class IdParser : public xmlpp::SaxViewParser
+{
+public:
+  IdParser()
+  : entry_pattern_("/feed/entry"), id_pattern_("/feed/entry/id"),
+    type_(intern("type"))
+  {
+    add_pattern(entry_pattern_);
+    add_pattern(id_pattern_);
+  }
+
+  long sum = 0;
+
+protected:
+  void on_pattern_match(std::size_t pattern_index, const QName& /* name */,
+    const NsAttributeList& attributes) override
+  {
+    if (pattern_index == 0)
+    {
+      const auto type = attributes.find(type_);
+      selected_entry_ = type != attributes.end() && (*type).value == "x";
+    }
+    else
+      in_id_ = selected_entry_;
+  }
+
+  void on_characters(const xmlpp::ustring& characters) override
+  {
+    if (in_id_)
+      sum += std::stol(characters);
+  }
+
+  void on_end_element(const xmlpp::ustring& /* name */) override
+  {
+    in_id_ = false;
+  }
+
+private:
+  const xmlpp::XPathPattern entry_pattern_;
+  const xmlpp::XPathPattern id_pattern_;
+  const InternedName type_;
+  bool selected_entry_ = false;
+  bool in_id_ = false;
+};
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  const int n_entries = argc > 1 ? std::atoi(argv[1]) : 100000;
+  if (n_entries <= 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [number-of-entries]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    const auto feed = make_feed(n_entries);
+
+    measure("DomParser and find()", [&]
+    {
+      xmlpp::DomParser parser;
+      parser.parse_memory(feed);
+      long sum = 0;
+      for (auto id : parser.get_document()->get_root_node()->find("/feed/entry[@type='x']/id"))
+        sum += std::stol(static_cast<const xmlpp::Element*>(id)->get_first_child_text()->get_content2().value_or("0"));
+      return sum;
+    });
+
+    measure("SaxViewParser with patterns", [&]
+    {
+      IdParser parser;
+      parser.parse_memory(feed);
+      return parser.sum;
+    });
+
+    measure("TextReader with a pattern", [&]
+    {
+      xmlpp::TextReader reader((const unsigned char*)feed.data(), feed.size());
+      const xmlpp::XPathPattern pattern("/feed/entry");
+      long sum = 0;
+      while (reader.read_to_match(pattern))
+      {
+        if (reader.get_attribute2("type") != "x")
+          continue;
+        // The first child element is the id.
+        while (reader.read() && reader.get_node_type() != xmlpp::TextReader::NodeType::Element)
+          ;
+        sum += std::stol(reader.read_string2().value_or("0"));
+      }
+      return sum;
+    });
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
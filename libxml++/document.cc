@@ -7,7 +7,7 @@
  * which should be included with libxml++ as the file COPYING.
  */
 
-// xmlIndentTreeOutput is deprecated since libxml2 2.15.0.
+// xmlGetCompressMode() is deprecated since libxml2 2.14.0.
 // Ignore deprecations here.
 #define XML_DEPRECATED
 
@@ -15,8 +15,6 @@
 #include <libxml++/dtd.h>
 #include <libxml++/nodes/element.h>
 #include <libxml++/exceptions/internal_error.h>
-#include <libxml++/keepblanks.h>
-#include <libxml++/io/ostreamoutputbuffer.h>
 
 #include <libxml/parser.h> // XML_PARSE_NOXINCNODE, XML_PARSE_NOBASEFIX
 #include <libxml/tree.h>
@@ -25,6 +23,7 @@
 
 #include <iostream>
 #include <map>
+#include <ostream>
 
 namespace // anonymous
 {
@@ -136,6 +135,64 @@ void remove_found_wrappers(xmlNode* node, NodeMap& node_map)
     remove_found_wrappers(reinterpret_cast<xmlNode*>(attr), node_map);
 
 }
+
+// The output is formatted with save options, instead of the global
+// xmlIndentTreeOutput, so documents can be written from several threads at once.
+// XML_SAVE_AS_XML: As xmlSaveFormatFileEnc() and xmlDocDumpFormatMemoryEnc().
+int get_save_options(bool format)
+{
+  return XML_SAVE_AS_XML | (format ? XML_SAVE_FORMAT : 0);
+}
+
+// Write the document and free the save context.
+bool save_doc(xmlSaveCtxtPtr ctxt, xmlDocPtr doc)
+{
+  if (!ctxt)
+    return false;
+
+  const auto result = xmlSaveDoc(ctxt, doc);
+  return xmlSaveClose(ctxt) >= 0 && result >= 0;
+}
+
+extern "C"
+{
+// The context is a pointer to an xmlOutputBufferPtr, which is set after
+// the save context has been created. If the file could not be opened,
+// the save context is closed without writing anything.
+static int c_output_buffer_write(void* context, const char* buffer, int len)
+{
+  const auto output = *static_cast<xmlOutputBufferPtr*>(context);
+  if (!output)
+    return len;
+  const int result = xmlOutputBufferWrite(output, len, buffer);
+  return result < 0 ? -1 : len;
+}
+
+static int c_output_buffer_close(void* context)
+{
+  const auto output = *static_cast<xmlOutputBufferPtr*>(context);
+  if (!output)
+    return 0;
+  return xmlOutputBufferClose(output) < 0 ? -1 : 0;
+}
+
+static int c_ostream_write(void* context, const char* buffer, int len)
+{
+  auto output = static_cast<std::ostream*>(context);
+  // here we rely on the ostream implicit conversion to boolean, to know if the stream can be used and/or if the write succeded.
+  if (*output)
+    output->write(buffer, len);
+  return output->good() ? len : -1;
+}
+
+static int c_ostream_close(void* context)
+{
+  auto output = static_cast<std::ostream*>(context);
+  if (*output)
+    output->flush();
+  return output->good() ? 0 : -1;
+}
+} // extern "C"
 } // anonymous
 
 namespace xmlpp
@@ -180,6 +237,7 @@ Document::Document(const ustring& version)
 {
   if (!impl_)
     throw internal_error("Could not create Document.");
+  Node::create_wrapper_pool(impl_, false);
   impl_->_private = this;
 }
 
@@ -189,12 +247,23 @@ Document::Document(xmlDoc* doc)
   if (!impl_)
     throw internal_error("xmlDoc pointer cannot be nullptr");
 
+  Node::create_wrapper_pool(impl_);
+  impl_->_private = this;
+}
+
+Document::Document(xmlDoc* doc, NewDocument)
+  : impl_(doc)
+{
+  if (!impl_)
+    throw internal_error("xmlDoc pointer cannot be nullptr");
+
+  Node::create_wrapper_pool(impl_, false);
   impl_->_private = this;
 }
 
 Document::~Document()
 {
-  Node::free_wrappers(reinterpret_cast<xmlNode*>(impl_));
+  Node::free_wrapper_pool(impl_);
   xmlFreeDoc(impl_);
 }
 
@@ -258,6 +327,11 @@ const Element* Document::get_root_node() const
   return const_cast<Document*>(this)->get_root_node();
 }
 
+ElementRef Document::get_root_node_ref() const noexcept
+{
+  return ElementRef(xmlDocGetRootElement(impl_));
+}
+
 Element* Document::create_root_node(const ustring& name,
                                     const ustring& ns_uri,
                                     const ustring& ns_prefix)
@@ -373,13 +447,33 @@ void Document::do_write_to_file(
     const ustring& encoding,
     bool format)
 {
-  KeepBlanks k(KeepBlanks::Default);
-  xmlIndentTreeOutput = format?1:0;
   xmlResetLastError();
-  const int result = xmlSaveFormatFileEnc(filename.c_str(), impl_,
-    get_encoding_or_utf8(encoding), format?1:0);
 
-  if(result == -1)
+  // Compress the file as xmlSaveFormatFileEnc() would.
+  int compression = impl_->compression;
+  if (compression < 0)
+    compression = xmlGetCompressMode();
+
+  // Create the save context before the file is opened, so an existing file
+  // is not truncated if the context can't be created, for instance because
+  // the encoding is unknown.
+  xmlOutputBufferPtr buffer = nullptr;
+  auto ctxt = xmlSaveToIO(c_output_buffer_write, c_output_buffer_close, &buffer,
+    get_encoding_or_utf8(encoding), get_save_options(format));
+  if (!ctxt)
+  {
+    throw exception("do_write_to_file() failed.\n" + format_xml_error());
+  }
+
+  buffer = xmlOutputBufferCreateFilename(filename.c_str(), nullptr, compression);
+  if (!buffer)
+  {
+    const auto error_str = format_xml_error();
+    xmlSaveClose(ctxt);
+    throw exception("do_write_to_file() failed.\n" + error_str);
+  }
+
+  if (!save_doc(ctxt, impl_))
   {
     throw exception("do_write_to_file() failed.\n" + format_xml_error());
   }
@@ -389,17 +483,16 @@ ustring Document::do_write_to_string(
     const ustring& encoding,
     bool format)
 {
-  KeepBlanks k(KeepBlanks::Default);
-  xmlIndentTreeOutput = format?1:0;
-  xmlChar* buffer = nullptr;
-  int length = 0;
-
   xmlResetLastError();
-  xmlDocDumpFormatMemoryEnc(impl_, &buffer, &length,
-    get_encoding_or_utf8(encoding), format?1:0);
+  auto buffer = xmlBufferCreate();
+  if (!buffer)
+  {
+    throw exception("do_write_to_string() failed.\n" + format_xml_error());
+  }
 
-  if(!buffer)
+  if (!save_doc(xmlSaveToBuffer(buffer, get_encoding_or_utf8(encoding), get_save_options(format)), impl_))
   {
+    xmlBufferFree(buffer);
     throw exception("do_write_to_string() failed.\n" + format_xml_error());
   }
 
@@ -408,10 +501,11 @@ ustring Document::do_write_to_string(
   // Here we force the use of ustring::ustring( InputIterator begin, InputIterator end )
   // instead of ustring::ustring( const char*, size_type ) because it
   // expects the length of the string in characters, not in bytes.
-  ustring result( reinterpret_cast<const char *>(buffer), reinterpret_cast<const char *>(buffer + length) );
+  const auto content = reinterpret_cast<const char*>(xmlBufferContent(buffer));
+  ustring result(content, content + xmlBufferLength(buffer));
 
   // Deletes the original buffer
-  xmlFree(buffer);
+  xmlBufferFree(buffer);
   // Return a copy of the string
   return result;
 }
@@ -419,12 +513,11 @@ ustring Document::do_write_to_string(
 void Document::do_write_to_stream(std::ostream& output, const ustring& encoding, bool format)
 {
   // TODO assert document encoding is UTF-8 if encoding is different than UTF-8
-  OStreamOutputBuffer buffer(output, encoding);
   xmlResetLastError();
-  const int result = xmlSaveFormatFileTo(buffer.cobj(), impl_,
-    get_encoding_or_utf8(encoding), format ? 1 : 0);
+  auto ctxt = xmlSaveToIO(c_ostream_write, c_ostream_close, &output,
+    get_encoding_or_utf8(encoding), get_save_options(format));
 
-  if(result == -1)
+  if (!save_doc(ctxt, impl_))
   {
     throw exception("do_write_to_stream() failed.\n" + format_xml_error());
   }
@@ -14,6 +14,7 @@
 #include <libxml++/exceptions/parse_error.h>
 #include <libxml++/exceptions/internal_error.h>
 #include <libxml++/nodes/element.h>
+#include <libxml++/nodes/noderef.h>
 #include <libxml++/dtd.h>
 
 #include <string>
@@ -73,6 +74,7 @@ class Document : public NonCopyable
     ~Init() noexcept;
   };
 
+  friend class DomParser;
   friend class SaxParser;
 
 public:
@@ -91,6 +93,10 @@ public:
    */
   LIBXMLPP_API explicit Document(_xmlDoc* doc);
 
+  /** Destructor.
+   * The C++ wrappers of the document's nodes are allocated from a memory pool
+   * that belongs to the Document, and are usually freed all at once.
+   */
   LIBXMLPP_API ~Document() override;
 
 #ifndef LIBXMLXX_DISABLE_DEPRECATED
@@ -141,6 +147,15 @@ public:
   LIBXMLPP_API
   const Element* get_root_node() const;
 
+  /** Return a reference to the root node, without creating its C++ wrapper.
+   * See NodeRef.
+   * @return A reference to the root node if it exists, a reference to no node otherwise.
+   *
+   * @newin{5,8}
+   */
+  LIBXMLPP_API
+  ElementRef get_root_node_ref() const noexcept;
+
   /** Create the root element node.
    * If the document already contains a root element node, it is replaced, and
    * the old root element node and all its descendants are deleted.
@@ -313,6 +328,12 @@ private:
   LIBXMLPP_API
   void do_write_to_stream(std::ostream& output, const ustring& encoding, bool format);
 
+  // Used by DomParser for a document that it has just parsed. The nodes
+  // have no C++ wrappers yet, so they are not searched for wrappers.
+  struct NewDocument {};
+  LIBXMLPP_API
+  Document(_xmlDoc* doc, NewDocument);
+
   static Init init_;
 
   _xmlDoc* impl_;
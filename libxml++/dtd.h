@@ -27,6 +27,9 @@ namespace xmlpp
 // why it has not been done in libxml++ 3.0.
 /** Represents an XML DTD for validating XML files.
  * DTD = %Document Type Definition
+ *
+ * A DTD can be shared by several threads through a
+ * <tt>std::shared_ptr<const Dtd></tt>, see SharedSchemaValidator.
  */
 class Dtd : public NonCopyable
 {
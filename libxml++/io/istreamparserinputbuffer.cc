@@ -8,6 +8,66 @@
  */
 
 #include <libxml++/io/istreamparserinputbuffer.h>
+#include <libxml++/io/istreamreader.h>
+
+#include <libxml/globals.h> //Needed by libxml/xmlIO.h
+#include <libxml/xmlIO.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+struct ReaderContext
+{
+  ReaderContext(std::istream& input_stream, std::unique_ptr<xmlpp::IStreamReader> stream_reader)
+  : input(input_stream), reader(std::move(stream_reader))
+  {}
+
+  std::istream& input;
+  std::unique_ptr<xmlpp::IStreamReader> reader;
+};
+
+// The IStreamReader of each IStreamParserInputBuffer. It's kept here, and not
+// in a data member, so the size of IStreamParserInputBuffer is not changed.
+// The map is used only when a buffer is created or destroyed. libxml2 gets
+// the ReaderContext as the context of its read callback, so each block is
+// read without a lookup and without the lock.
+std::mutex readers_mutex;
+std::unordered_map<const xmlpp::IStreamParserInputBuffer*,
+  std::unique_ptr<ReaderContext>> readers;
+
+int read_callback(void* context, char* buffer, int len)
+{
+  return static_cast<ReaderContext*>(context)->reader->read(buffer, len);
+}
+
+int close_callback(void* context)
+{
+  return static_cast<ReaderContext*>(context)->input.good();
+}
+
+void add_reader(xmlpp::IStreamParserInputBuffer* buffer, std::istream& input,
+  std::unique_ptr<xmlpp::IStreamReader> reader)
+{
+  auto context = std::make_unique<ReaderContext>(input, std::move(reader));
+  const auto cbuffer = buffer->cobj();
+  cbuffer->context = context.get();
+  cbuffer->readcallback = &read_callback;
+  cbuffer->closecallback = &close_callback;
+
+  std::lock_guard<std::mutex> lock(readers_mutex);
+  readers[buffer] = std::move(context);
+}
+
+ReaderContext* get_reader(const xmlpp::IStreamParserInputBuffer* buffer)
+{
+  std::lock_guard<std::mutex> lock(readers_mutex);
+  const auto iter = readers.find(buffer);
+  return iter == readers.end() ? nullptr : iter->second.get();
+}
+} // anonymous namespace
 
 namespace xmlpp
 {
@@ -15,26 +75,38 @@ namespace xmlpp
       std::istream & input)
     : ParserInputBuffer(), input_(input)
   {
+    add_reader(this, input, std::make_unique<IStreamReader>(input));
+  }
+
+  IStreamParserInputBuffer::IStreamParserInputBuffer(
+      std::istream & input, std::size_t block_size, bool read_ahead)
+    : ParserInputBuffer(), input_(input)
+  {
+    add_reader(this, input, std::make_unique<IStreamReader>(input, block_size, read_ahead));
   }
 
   IStreamParserInputBuffer::~IStreamParserInputBuffer()
   {
+    // Destroy the reader outside of the lock. It may wait for its thread.
+    std::unique_ptr<ReaderContext> context;
+    {
+      std::lock_guard<std::mutex> lock(readers_mutex);
+      const auto iter = readers.find(this);
+      if (iter != readers.end())
+      {
+        context = std::move(iter->second);
+        readers.erase(iter);
+      }
+    }
   }
 
   int IStreamParserInputBuffer::do_read(
       char * buffer,
       int len)
   {
-    int l=0;
-    if(input_)
-    {
-      // This is the correct statement - but gcc 2.95.3 lacks this method
-      //l = input_.readsome(buffer, len);
-      input_.read(buffer, len);
-      l = input_.gcount();
-    }
-
-    return l;
+    // libxml2 calls read_callback(). This is used only by ParserInputBuffer::on_read().
+    const auto context = get_reader(this);
+    return context ? context->reader->read(buffer, len) : -1;
   }
 
   bool IStreamParserInputBuffer::do_close()
@@ -12,6 +12,7 @@
 
 #include <libxml++/io/parserinputbuffer.h>
 
+#include <cstddef>
 #include <istream>
 
 namespace xmlpp
@@ -23,6 +24,17 @@ namespace xmlpp
        * @param input The istream datas will be read from
        */
       IStreamParserInputBuffer(std::istream& input);
+
+      /**
+       * @newin{5,8}
+       *
+       * @param input The istream datas will be read from
+       * @param block_size The number of bytes to read from the stream at a time.
+       * @param read_ahead Whether to read blocks ahead on a background thread.
+       *        See IStreamReader.
+       */
+      IStreamParserInputBuffer(std::istream& input, std::size_t block_size,
+        bool read_ahead = false);
       ~IStreamParserInputBuffer() override;
 
     private:
@@ -0,0 +1,314 @@
+/* istreamreader.cc
+ * this file is part of libxml++
+ *
+ * copyright (C) 2026 by libxml++ developer's team
+ *
+ * this file is covered by the GNU Lesser General Public License,
+ * which should be included with libxml++ as the file COPYING.
+ */
+
+#include <libxml++/io/istreamreader.h>
+
+#include <algorithm> // std::min()
+#include <condition_variable>
+#include <cstring> // std::memcpy()
+#include <mutex>
+#include <thread>
+
+namespace xmlpp
+{
+  namespace
+  {
+    // Blocks in use while reading ahead. One is handed out to the parser,
+    // while the background thread fills the other one.
+    constexpr std::size_t n_read_ahead_blocks = 2;
+  }
+
+  struct IStreamReader::Impl
+  {
+    Impl(std::istream& input, std::size_t block_size, bool read_ahead)
+    : input_(input), block_size_(block_size ? block_size : default_block_size),
+      read_ahead_(read_ahead)
+    {}
+
+    ~Impl()
+    {
+      if (thread_.joinable())
+      {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stop_ = true;
+        }
+        cond_.notify_all();
+        thread_.join();
+      }
+    }
+
+    void start() noexcept;
+    bool next_block() noexcept;
+    bool next_block_read_ahead() noexcept;
+    void read_ahead_thread() noexcept;
+    std::streamsize sgetn(char* buffer, std::size_t len) noexcept;
+    void set_state(std::ios_base::iostate state) noexcept;
+
+    std::istream& input_;
+    std::streambuf* streambuf_ = nullptr;
+    const std::size_t block_size_;
+    const bool read_ahead_;
+
+    bool started_ = false;
+    bool at_end_ = false;
+    bool failed_ = false;
+
+    // The block that is being handed out to the parser.
+    const char* data_ = nullptr;
+    std::size_t begin_ = 0;
+    std::size_t end_ = 0;
+
+    // Without read-ahead.
+    std::unique_ptr<char[]> block_;
+
+    // With read-ahead. Protected by mutex_, except the contents of
+    // blocks that are owned by one of the threads.
+    struct Block
+    {
+      std::unique_ptr<char[]> data;
+      std::size_t size = 0;
+    };
+    Block blocks_[n_read_ahead_blocks];
+    std::size_t n_filled_ = 0;  // Including the block handed out to the parser.
+    std::size_t first_filled_ = 0;
+    bool handed_out_ = false;
+    bool thread_done_ = false;
+    bool thread_failed_ = false;
+    bool stop_ = false;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::thread thread_;
+  };
+
+  void IStreamReader::Impl::start() noexcept
+  {
+    started_ = true;
+
+    // Like the sentry object of an istream.
+    try
+    {
+      if (input_.good() && input_.tie())
+        input_.tie()->flush();
+    }
+    catch (...)
+    {
+    }
+
+    if (!input_.good() || !input_.rdbuf())
+    {
+      at_end_ = true;
+      return;
+    }
+    streambuf_ = input_.rdbuf();
+
+    try
+    {
+      if (read_ahead_)
+      {
+        for (auto& block : blocks_)
+          block.data.reset(new char[block_size_]);
+        thread_ = std::thread(&Impl::read_ahead_thread, this);
+      }
+      else
+        block_.reset(new char[block_size_]);
+    }
+    catch (...)
+    {
+      // Out of memory, or no more threads.
+      at_end_ = true;
+      failed_ = true;
+    }
+  }
+
+  std::streamsize IStreamReader::Impl::sgetn(char* buffer, std::size_t len) noexcept
+  {
+    try
+    {
+      return streambuf_->sgetn(buffer, static_cast<std::streamsize>(len));
+    }
+    catch (...)
+    {
+      return -1;
+    }
+  }
+
+  void IStreamReader::Impl::set_state(std::ios_base::iostate state) noexcept
+  {
+    try
+    {
+      input_.setstate(state);
+    }
+    catch (...)
+    {
+      // The stream's exception mask. The state is set anyway,
+      // and the exception must not propagate into libxml2.
+    }
+  }
+
+  bool IStreamReader::Impl::next_block() noexcept
+  {
+    if (read_ahead_)
+      return next_block_read_ahead();
+
+    if (at_end_)
+      return false;
+
+    const auto n = sgetn(block_.get(), block_size_);
+    if (n < 0)
+    {
+      at_end_ = true;
+      failed_ = true;
+      return false;
+    }
+
+    // sgetn() returns less than requested only at the end of the stream.
+    if (static_cast<std::size_t>(n) < block_size_)
+      at_end_ = true;
+
+    data_ = block_.get();
+    begin_ = 0;
+    end_ = static_cast<std::size_t>(n);
+    return n > 0;
+  }
+
+  bool IStreamReader::Impl::next_block_read_ahead() noexcept
+  {
+    if (at_end_)
+      return false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Give back the block that the parser has consumed.
+    if (handed_out_)
+    {
+      handed_out_ = false;
+      first_filled_ = (first_filled_ + 1) % n_read_ahead_blocks;
+      --n_filled_;
+      cond_.notify_all();
+    }
+
+    cond_.wait(lock, [this] { return n_filled_ > 0 || thread_done_; });
+    if (n_filled_ == 0)
+    {
+      at_end_ = true;
+      failed_ = thread_failed_;
+      return false;
+    }
+
+    const auto& block = blocks_[first_filled_];
+    handed_out_ = true;
+    data_ = block.data.get();
+    begin_ = 0;
+    end_ = block.size;
+    return true;
+  }
+
+  void IStreamReader::Impl::read_ahead_thread() noexcept
+  {
+    std::size_t next = 0;
+    for (;;)
+    {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return stop_ || n_filled_ < n_read_ahead_blocks; });
+        if (stop_)
+          return;
+      }
+
+      // blocks_[next] is not filled, so the parser doesn't use it.
+      auto& block = blocks_[next];
+      const auto n = sgetn(block.data.get(), block_size_);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (n < 0)
+          thread_failed_ = true;
+        else if (n > 0)
+        {
+          block.size = static_cast<std::size_t>(n);
+          next = (next + 1) % n_read_ahead_blocks;
+          ++n_filled_;
+        }
+        if (n < 0 || static_cast<std::size_t>(n) < block_size_)
+          thread_done_ = true;
+      }
+      cond_.notify_all();
+
+      if (n < 0 || static_cast<std::size_t>(n) < block_size_)
+        return;
+    }
+  }
+
+  IStreamReader::IStreamReader(std::istream& input, std::size_t block_size, bool read_ahead)
+    : pimpl_(new Impl(input, block_size, read_ahead))
+  {
+  }
+
+  IStreamReader::~IStreamReader()
+  {
+  }
+
+  int IStreamReader::read(char* buffer, int len) noexcept
+  {
+    if (len <= 0)
+      return 0;
+
+    auto& impl = *pimpl_;
+    if (!impl.started_)
+      impl.start();
+
+    if (impl.begin_ == impl.end_)
+    {
+      // A request for at least a block needs no copy through the block.
+      if (!impl.read_ahead_ && !impl.at_end_ && static_cast<std::size_t>(len) >= impl.block_size_)
+      {
+        const auto n = impl.sgetn(buffer, static_cast<std::size_t>(len));
+        if (n < 0)
+        {
+          impl.at_end_ = true;
+          impl.failed_ = true;
+        }
+        else
+        {
+          if (n < len)
+            impl.at_end_ = true;
+          if (n > 0)
+            return static_cast<int>(n);
+        }
+      }
+      else
+        impl.next_block();
+
+      if (impl.begin_ == impl.end_)
+      {
+        // Like std::istream::read(), which sets failbit if it can't read all
+        // the requested bytes.
+        impl.set_state(impl.failed_ ? std::ios_base::badbit :
+          std::ios_base::eofbit | std::ios_base::failbit);
+        return impl.failed_ ? -1 : 0;
+      }
+    }
+
+    const auto n = std::min(static_cast<std::size_t>(len), impl.end_ - impl.begin_);
+    std::memcpy(buffer, impl.data_ + impl.begin_, n);
+    impl.begin_ += n;
+    return static_cast<int>(n);
+  }
+
+  std::size_t IStreamReader::get_block_size() const noexcept
+  {
+    return pimpl_->block_size_;
+  }
+
+  bool IStreamReader::get_read_ahead() const noexcept
+  {
+    return pimpl_->read_ahead_;
+  }
+}
@@ -0,0 +1,82 @@
+/* istreamreader.h
+ * this file is part of libxml++
+ *
+ * copyright (C) 2026 by libxml++ developer's team
+ *
+ * this file is covered by the GNU Lesser General Public License,
+ * which should be included with libxml++ as the file COPYING.
+ */
+
+#ifndef __LIBXMLPP_ISTREAMREADER_H
+#define __LIBXMLPP_ISTREAMREADER_H
+
+#include <libxml++/noncopyable.h>
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+
+namespace xmlpp
+{
+  /** Reads an istream in large blocks, for a parser.
+   *
+   * libxml2 asks for input in small pieces. Instead of calling
+   * std::istream::read() for each piece, with the overhead of a sentry
+   * object and a gcount() call each time, this reader fills a large block
+   * with one std::streambuf::sgetn() call on the stream's buffer, and hands
+   * out pieces of the block.
+   *
+   * Optionally, the blocks are read ahead on a background thread, so that
+   * reading a slow stream, such as a socket, overlaps with parsing.
+   * While a read-ahead reader exists, the stream's buffer must not be used
+   * by anyone else.
+   *
+   * The reader may read more of the stream than the parser consumes.
+   * When the end of the stream is reached, eofbit and failbit are set in the
+   * stream's state, as std::istream::read() sets them. If the stream's buffer throws an exception, badbit is set.
+   *
+   * @newin{5,8}
+   */
+  class LIBXMLPP_API IStreamReader: public NonCopyable
+  {
+    public:
+      /// The default size of each block, in bytes.
+      static constexpr std::size_t default_block_size = 64 * 1024;
+
+      /**
+       * @param input The istream data will be read from.
+       * @param block_size The number of bytes to read from the stream at a time.
+       * @param read_ahead Whether to read blocks ahead on a background thread.
+       */
+      explicit IStreamReader(std::istream& input,
+        std::size_t block_size = default_block_size, bool read_ahead = false);
+
+      /** Stops reading ahead.
+       * If the background thread is waiting for input from the stream's
+       * buffer, the destructor waits for that read to finish.
+       */
+      ~IStreamReader() override;
+
+      /** Copy bytes from the stream.
+       * @param buffer Where the bytes are copied to.
+       * @param len The maximum number of bytes to copy.
+       * @returns The number of bytes copied, 0 at the end of the stream,
+       *          or -1 if the stream's buffer threw an exception.
+       */
+      int read(char* buffer, int len) noexcept;
+
+      /** The number of bytes read from the stream at a time.
+       */
+      std::size_t get_block_size() const noexcept;
+
+      /** Whether blocks are read ahead on a background thread.
+       */
+      bool get_read_ahead() const noexcept;
+
+    private:
+      struct Impl;
+      std::unique_ptr<Impl> pimpl_;
+  };
+}
+
+#endif
@@ -0,0 +1,186 @@
+/* mappedfile.cc
+ * this file is part of libxml++
+ *
+ * copyright (C) 2026 by libxml++ developer's team
+ *
+ * this file is covered by the GNU Lesser General Public License,
+ * which should be included with libxml++ as the file COPYING.
+ */
+
+#include <libxml++/io/mappedfile.h>
+#include <libxml++/exceptions/internal_error.h>
+
+#include <algorithm> // std::min()
+#include <cerrno>
+#include <cstring> // std::memcpy(), std::strerror()
+#include <utility> // std::move()
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace xmlpp
+{
+  MappedFile::MappedFile(const std::string& filename)
+    : filename_(filename), data_(nullptr), size_(0), position_(0)
+#ifdef _WIN32
+      , mapping_handle_(nullptr)
+#endif
+  {
+#ifdef _WIN32
+    const HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+      nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      throw internal_error("Could not open file " + filename);
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size))
+    {
+      CloseHandle(file);
+      throw internal_error("Could not get the size of file " + filename);
+    }
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+
+    if (size_ > 0)
+    {
+      mapping_handle_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping_handle_)
+        data_ = static_cast<const unsigned char*>(
+          MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+    }
+    CloseHandle(file);
+
+    if (size_ > 0 && !data_)
+    {
+      release();
+      throw internal_error("Could not map file " + filename);
+    }
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw internal_error("Could not open file " + filename + ": " + std::strerror(errno));
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) < 0)
+    {
+      const int err = errno;
+      close(fd);
+      throw internal_error("Could not get the size of file " + filename + ": " + std::strerror(err));
+    }
+    size_ = static_cast<std::size_t>(file_stat.st_size);
+
+    if (size_ > 0)
+    {
+      void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED)
+      {
+        const int err = errno;
+        close(fd);
+        throw internal_error("Could not map file " + filename + ": " + std::strerror(err));
+      }
+      data_ = static_cast<const unsigned char*>(addr);
+#ifdef MADV_SEQUENTIAL
+      // Only a hint. The file is read correctly even if it fails.
+      madvise(addr, size_, MADV_SEQUENTIAL);
+#endif
+    }
+    // The mapping stays valid when the file is closed.
+    close(fd);
+#endif
+  }
+
+  MappedFile::~MappedFile()
+  {
+    release();
+  }
+
+  MappedFile::MappedFile(MappedFile&& other) noexcept
+    : filename_(std::move(other.filename_)), data_(other.data_), size_(other.size_),
+      position_(other.position_)
+#ifdef _WIN32
+      , mapping_handle_(other.mapping_handle_)
+#endif
+  {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.position_ = 0;
+#ifdef _WIN32
+    other.mapping_handle_ = nullptr;
+#endif
+  }
+
+  MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+  {
+    if (this != &other)
+    {
+      release();
+      filename_ = std::move(other.filename_);
+      data_ = other.data_;
+      size_ = other.size_;
+      position_ = other.position_;
+      other.data_ = nullptr;
+      other.size_ = 0;
+      other.position_ = 0;
+#ifdef _WIN32
+      mapping_handle_ = other.mapping_handle_;
+      other.mapping_handle_ = nullptr;
+#endif
+    }
+    return *this;
+  }
+
+  void MappedFile::release() noexcept
+  {
+#ifdef _WIN32
+    if (data_)
+      UnmapViewOfFile(data_);
+    if (mapping_handle_)
+      CloseHandle(mapping_handle_);
+    mapping_handle_ = nullptr;
+#else
+    if (data_)
+      munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    position_ = 0;
+  }
+
+  const unsigned char* MappedFile::data() const noexcept
+  {
+    return data_;
+  }
+
+  std::size_t MappedFile::size() const noexcept
+  {
+    return size_;
+  }
+
+  const std::string& MappedFile::get_filename() const noexcept
+  {
+    return filename_;
+  }
+
+  int MappedFile::read(char* buffer, int len) noexcept
+  {
+    if (len <= 0)
+      return 0;
+
+    const auto n = (std::min)(static_cast<std::size_t>(len), size_ - position_);
+    if (n > 0)
+      std::memcpy(buffer, data_ + position_, n);
+    position_ += n;
+    return static_cast<int>(n);
+  }
+
+  void MappedFile::rewind() noexcept
+  {
+    position_ = 0;
+  }
+}
@@ -0,0 +1,88 @@
+/* mappedfile.h
+ * this file is part of libxml++
+ *
+ * copyright (C) 2026 by libxml++ developer's team
+ *
+ * this file is covered by the GNU Lesser General Public License,
+ * which should be included with libxml++ as the file COPYING.
+ */
+
+#ifndef __LIBXMLPP_MAPPEDFILE_H
+#define __LIBXMLPP_MAPPEDFILE_H
+
+#include <libxml++config.h>
+
+#include <cstddef>
+#include <string>
+
+namespace xmlpp
+{
+  /** A read-only file, mapped into memory.
+   *
+   * The parsers can parse a mapped file directly from the operating system's
+   * page cache, instead of copying it through read() calls into the parser's
+   * input buffer. See DomParser::parse_mapped_file(),
+   * SaxParser::parse_mapped_file() and TextReader::TextReader(MappedFile&&).
+   *
+   * The operating system is told that the file will be read sequentially,
+   * where that is supported.
+   *
+   * @newin{5,8}
+   */
+  class LIBXMLPP_API MappedFile
+  {
+    public:
+      /** Map a file into memory.
+       * @param filename The path to the file.
+       * @throws xmlpp::internal_error If the file can't be opened or mapped.
+       */
+      explicit MappedFile(const std::string& filename);
+      ~MappedFile();
+
+      MappedFile(const MappedFile&) = delete;
+      MappedFile& operator=(const MappedFile&) = delete;
+      MappedFile(MappedFile&& other) noexcept;
+      MappedFile& operator=(MappedFile&& other) noexcept;
+
+      /** The contents of the file.
+       * @returns A pointer to the first byte, or <tt>nullptr</tt> if the file is empty.
+       */
+      const unsigned char* data() const noexcept;
+
+      /** The number of bytes in the file.
+       */
+      std::size_t size() const noexcept;
+
+      /** The path of the file, as given to the constructor.
+       */
+      const std::string& get_filename() const noexcept;
+
+      /** Copy bytes from the current read position, and advance it.
+       *
+       * libxml2 can parse at most 2 GiB from memory in one piece. Larger files
+       * are fed to the parser with this function from a read callback.
+       *
+       * @param buffer Where the bytes are copied to.
+       * @param len The maximum number of bytes to copy.
+       * @returns The number of bytes copied. 0 at the end of the file.
+       */
+      int read(char* buffer, int len) noexcept;
+
+      /** Move the read position to the start of the file.
+       */
+      void rewind() noexcept;
+
+    private:
+      void release() noexcept;
+
+      std::string filename_;
+      const unsigned char* data_;
+      std::size_t size_;
+      std::size_t position_;
+#ifdef _WIN32
+      void* mapping_handle_;
+#endif
+  };
+}
+
+#endif
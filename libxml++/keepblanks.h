@@ -15,6 +15,10 @@ namespace xmlpp
   /** This class sets KeepBlanksDefault and IndentTreeOutput of libxmlpp
    * and restores their initial values in its destructor. As a consequence
    * the wanted setting is kept during instance lifetime.
+   *
+   * libxml++'s parsers and Document's write functions don't use these
+   * global settings. To drop blank text nodes when parsing, use
+   * Parser::set_parser_options() with XML_PARSE_NOBLANKS.
    */
   class LIBXMLPP_API KeepBlanks {
     public:
@@ -53,9 +53,15 @@
 #include <libxml++/exceptions/internal_error.h>
 #include <libxml++/exceptions/parse_error.h>
 #include <libxml++/parsers/domparser.h>
+#include <libxml++/parsers/parserpool.h>
 #include <libxml++/parsers/saxparser.h>
+#include <libxml++/parsers/saxviewparser.h>
+#include <libxml++/parsers/saxdispatchparser.h>
+#include <libxml++/parsers/saxsubtreeparser.h>
 #include <libxml++/parsers/textreader.h>
 #include <libxml++/nodes/node.h>
+#include <libxml++/nodes/noderange.h>
+#include <libxml++/nodes/noderef.h>
 #include <libxml++/nodes/cdatanode.h>
 #include <libxml++/nodes/commentnode.h>
 #include <libxml++/nodes/element.h>
@@ -72,9 +78,16 @@
 #include <libxml++/relaxngschema.h>
 #include <libxml++/xsdschema.h>
 #include <libxml++/validators/validator.h>
+#include <libxml++/validators/batchvalidator.h>
 #include <libxml++/validators/dtdvalidator.h>
 #include <libxml++/validators/relaxngvalidator.h>
+#include <libxml++/validators/sharedschemavalidator.h>
 #include <libxml++/validators/xsdvalidator.h>
 #include <libxml++/ustring.h>
+#include <libxml++/xmlwriter.h>
+#include <libxml++/xpathcontext.h>
+#include <libxml++/xpathexpression.h>
+#include <libxml++/xpathnodeset.h>
+#include <libxml++/xpathpattern.h>
 
 #endif //__LIBXMLCPP_H
@@ -18,11 +18,21 @@
 #include <libxml++/attributedeclaration.h>
 #include <libxml++/attributenode.h>
 #include <libxml++/document.h>
+#include <libxml++/xpathcontext.h>
+#include <libxml++/xpathexpression.h>
 #include <libxml/xpath.h>
 #include <libxml/xpathInternals.h>
 #include <libxml/tree.h>
 
+#include <algorithm> // std::min()
+#include <atomic>
+#include <cstddef> // std::max_align_t
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <new> // ::operator new()
+#include <unordered_map>
+#include <vector>
 
 namespace // anonymous
 {
@@ -53,7 +63,8 @@ Tlist get_children_common(const xmlpp::ustring& name, xmlNode* child)
   return children;
 }
 
-// A common part of all overloaded xmlpp::Node::find() and eval_xpath() methods.
+// A common part of all overloaded xmlpp::Node::find() and eval_xpath() methods
+// with an uncompiled XPath expression.
 xmlXPathObject* find_common1(const xmlpp::ustring& xpath,
   const xmlpp::Node::PrefixNsMap* namespaces, xmlNode* node)
 {
@@ -79,6 +90,16 @@ xmlXPathObject* find_common1(const xmlpp::ustring& xpath,
   return result;
 }
 
+// A common part of all overloaded xmlpp::Node::find() and eval_xpath() methods
+// with a compiled XPath expression.
+xmlXPathObject* check_compiled_result(xmlXPathObject* result, const xmlpp::XPathExpression& xpath)
+{
+  if (!result)
+    throw xmlpp::exception("Invalid XPath: " + xpath.get_expression());
+
+  return result;
+}
+
 // A common part of all overloaded xmlpp::Node::find() and eval_xpath() methods.
 // Tvector == NodeSet or const_NodeSet
 // result->type == XPATH_NODESET
@@ -125,11 +146,8 @@ Tvector find_common2(xmlXPathObject* result, const char* method_name)
 
 // Common part of all overloaded xmlpp::Node::find() methods.
 template <typename Tvector>
-Tvector find_common(const xmlpp::ustring& xpath,
-  const xmlpp::Node::PrefixNsMap* namespaces, xmlNode* node)
+Tvector find_common(xmlXPathObject* result)
 {
-  auto result = find_common1(xpath, namespaces, node);
-
   if (result->type != XPATH_NODESET)
   {
     xmlXPathFreeObject(result);
@@ -138,14 +156,23 @@ Tvector find_common(const xmlpp::ustring& xpath,
   return find_common2<Tvector>(result, "find");
 }
 
+// Common part of all overloaded xmlpp::Node::find_first(), count() and select() methods.
+// Returns the node-set in the result, which the caller shall free.
+xmlNodeSet* get_nodeset(xmlXPathObject* result)
+{
+  if (result->type != XPATH_NODESET)
+  {
+    xmlXPathFreeObject(result);
+    throw xmlpp::internal_error("Only nodeset result types are supported.");
+  }
+  return result->nodesetval;
+}
+
 // Common part of all overloaded xmlpp::Node::eval_xpath() methods.
 template <typename Tvector>
 std::variant<Tvector, bool, double, xmlpp::ustring>
-eval_xpath_common(const xmlpp::ustring& xpath,
-  const xmlpp::Node::PrefixNsMap* namespaces, xmlNode* node)
+eval_xpath_common(xmlXPathObject* result)
 {
-  auto result = find_common1(xpath, namespaces, node);
-
   switch (result->type)
   {
   case XPATH_NODESET:
@@ -176,28 +203,10 @@ eval_xpath_common(const xmlpp::ustring& xpath,
 }
 
 // Common part of xmlpp::Node::eval_to_[boolean|number|string]
-xmlXPathObject* eval_common(const xmlpp::ustring& xpath,
-  const xmlpp::Node::PrefixNsMap* namespaces,
-  xmlpp::XPathResultType* result_type, xmlNode* node)
+// Sets the result type. Throws if the evaluation failed.
+xmlXPathObject* eval_common2(xmlXPathObject* xpath_value, const xmlpp::ustring& xpath,
+  xmlpp::XPathResultType* result_type)
 {
-  auto ctxt = xmlXPathNewContext(node->doc);
-  if (!ctxt)
-    throw xmlpp::internal_error("Could not create XPath context for " + xpath);
-  ctxt->node = node;
-
-  if (namespaces)
-  {
-    for (const auto& [prefix, ns_uri] : *namespaces)
-      xmlXPathRegisterNs(ctxt,
-        reinterpret_cast<const xmlChar*>(prefix.c_str()),
-        reinterpret_cast<const xmlChar*>(ns_uri.c_str()));
-  }
-
-  auto xpath_value = xmlXPathEval(
-    reinterpret_cast<const xmlChar*>(xpath.c_str()), ctxt);
-
-  xmlXPathFreeContext(ctxt);
-
   if (!xpath_value)
   {
     if (result_type)
@@ -220,34 +229,51 @@ xmlXPathObject* eval_common(const xmlpp::ustring& xpath,
   return xpath_value;
 }
 
-// Common part of all overloaded xmlpp::Node::eval_to_boolean() methods.
-bool eval_common_to_boolean(const xmlpp::ustring& xpath,
+// Common part of xmlpp::Node::eval_to_[boolean|number|string]
+xmlXPathObject* eval_common(const xmlpp::ustring& xpath,
   const xmlpp::Node::PrefixNsMap* namespaces,
   xmlpp::XPathResultType* result_type, xmlNode* node)
 {
-  auto xpath_value = eval_common(xpath, namespaces, result_type, node);
+  auto ctxt = xmlXPathNewContext(node->doc);
+  if (!ctxt)
+    throw xmlpp::internal_error("Could not create XPath context for " + xpath);
+  ctxt->node = node;
+
+  if (namespaces)
+  {
+    for (const auto& [prefix, ns_uri] : *namespaces)
+      xmlXPathRegisterNs(ctxt,
+        reinterpret_cast<const xmlChar*>(prefix.c_str()),
+        reinterpret_cast<const xmlChar*>(ns_uri.c_str()));
+  }
+
+  auto xpath_value = xmlXPathEval(
+    reinterpret_cast<const xmlChar*>(xpath.c_str()), ctxt);
+
+  xmlXPathFreeContext(ctxt);
+
+  return eval_common2(xpath_value, xpath, result_type);
+}
+
+// Common part of all overloaded xmlpp::Node::eval_to_boolean() methods.
+bool eval_common_to_boolean(xmlXPathObject* xpath_value)
+{
   const int result = xmlXPathCastToBoolean(xpath_value);
   xmlXPathFreeObject(xpath_value);
   return static_cast<bool>(result);
 }
 
 // Common part of all overloaded xmlpp::Node::eval_to_number() methods.
-double eval_common_to_number(const xmlpp::ustring& xpath,
-  const xmlpp::Node::PrefixNsMap* namespaces,
-  xmlpp::XPathResultType* result_type, xmlNode* node)
+double eval_common_to_number(xmlXPathObject* xpath_value)
 {
-  auto xpath_value = eval_common(xpath, namespaces, result_type, node);
   const double result = xmlXPathCastToNumber(xpath_value);
   xmlXPathFreeObject(xpath_value);
   return result;
 }
 
 // Common part of all overloaded xmlpp::Node::eval_to_string() methods.
-xmlpp::ustring eval_common_to_string(const xmlpp::ustring& xpath,
-  const xmlpp::Node::PrefixNsMap* namespaces,
-  xmlpp::XPathResultType* result_type, xmlNode* node)
+xmlpp::ustring eval_common_to_string(xmlXPathObject* xpath_value)
 {
-  auto xpath_value = eval_common(xpath, namespaces, result_type, node);
   xmlChar* result = xmlXPathCastToString(xpath_value);
   xmlXPathFreeObject(xpath_value);
   if (result)
@@ -259,6 +285,195 @@ xmlpp::ustring eval_common_to_string(const xmlpp::ustring& xpath,
   return {};
 }
 
+// The memory pool of the C++ wrappers of the nodes of a Document.
+//
+// Each wrapper, whether it's allocated from a pool or on the heap, is preceded
+// by a pointer to the pool, or nullptr. Node::operator delete() can then free
+// any wrapper, also one that has been allocated for another Document.
+// All blocks of a pool are freed at once, when the Document is deleted.
+// A block that is freed earlier, when a node is removed, is reused.
+//
+// The pools are kept in a table keyed by the xmlDoc, and not in the
+// Document, so the size of Document is not changed.
+struct WrapperPool
+{
+  // The memory preceding a wrapper that is allocated on the heap.
+  static constexpr std::size_t heap_header_size = alignof(std::max_align_t);
+  // A wrapper in a pool is a Node, or a class derived from Node without data
+  // members of its own.
+  static constexpr std::size_t wrapper_size = sizeof(xmlpp::Node);
+  static constexpr std::size_t block_size = sizeof(WrapperPool*) + wrapper_size;
+  static constexpr std::size_t min_chunk_blocks = 64;
+  static constexpr std::size_t max_chunk_blocks = 16384;
+
+  static WrapperPool*& pool_of(void* wrapper) noexcept
+  {
+    return *reinterpret_cast<WrapperPool**>(static_cast<unsigned char*>(wrapper) - sizeof(WrapperPool*));
+  }
+
+  // Wrappers of the nodes of a const Document may be created by several
+  // threads, so the pool is locked.
+  void* allocate()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (free_wrappers)
+    {
+      const auto wrapper = free_wrappers;
+      free_wrappers = *static_cast<void**>(free_wrappers);
+      return wrapper;
+    }
+
+    if (next_block == chunk_end)
+    {
+      const auto chunk_size = next_chunk_blocks * block_size;
+      chunks.emplace_back(new unsigned char[chunk_size]);
+      next_block = chunks.back().get();
+      chunk_end = next_block + chunk_size;
+      next_chunk_blocks = std::min(2 * next_chunk_blocks, max_chunk_blocks);
+    }
+
+    const auto wrapper = next_block + sizeof(WrapperPool*);
+    next_block += block_size;
+    pool_of(wrapper) = this;
+    return wrapper;
+  }
+
+  void deallocate(void* wrapper) noexcept
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    *static_cast<void**>(wrapper) = free_wrappers;
+    free_wrappers = wrapper;
+  }
+
+  std::mutex mutex;
+  std::vector<std::unique_ptr<unsigned char[]>> chunks;
+  unsigned char* next_block = nullptr;
+  unsigned char* chunk_end = nullptr;
+  std::size_t next_chunk_blocks = min_chunk_blocks;
+  // Singly linked list of freed wrappers.
+  void* free_wrappers = nullptr;
+
+  // True if a wrapper of one of the document's nodes has been constructed in
+  // memory that was not allocated by allocate(), or before the pool existed.
+  // Then the wrappers are deleted one by one, when the Document is deleted.
+  std::atomic<bool> has_other_wrappers{false};
+};
+
+// The pools of all Documents. Protected by pools_mutex.
+std::mutex pools_mutex;
+std::unordered_map<const xmlDoc*, std::unique_ptr<WrapperPool>> pools;
+// Changed, while pools_mutex is locked, whenever a pool is added or removed.
+std::atomic<unsigned long> pools_generation{0};
+
+// The last pool that find_pool() found in this thread. It's valid as long
+// as pools_generation is unchanged.
+struct PoolCache
+{
+  const xmlDoc* doc = nullptr;
+  WrapperPool* pool = nullptr;
+  unsigned long generation = 0;
+};
+thread_local PoolCache pool_cache;
+
+// The wrapper that allocate_wrapper() returned in this thread, until the
+// wrapper is constructed.
+thread_local void* last_allocated = nullptr;
+
+// Find the pool of the Document of doc, if there is a Document.
+WrapperPool* find_pool(const xmlDoc* doc)
+{
+  // A Document that is used in this thread has been constructed before, so
+  // this thread sees the generation that was set when its pool was added.
+  // A pool in the cache cannot have been deleted and replaced without
+  // changing the generation.
+  if (pool_cache.doc == doc && pool_cache.generation == pools_generation.load(std::memory_order_acquire))
+    return pool_cache.pool;
+
+  std::lock_guard<std::mutex> lock(pools_mutex);
+  const auto iter = pools.find(doc);
+  pool_cache.doc = doc;
+  pool_cache.pool = iter == pools.end() ? nullptr : iter->second.get();
+  pool_cache.generation = pools_generation.load(std::memory_order_relaxed);
+  return pool_cache.pool;
+}
+
+void* allocate_wrapper(std::size_t size, const xmlNode* node)
+{
+  last_allocated = nullptr;
+  if (node && node->doc && size <= WrapperPool::wrapper_size)
+  {
+    if (auto pool = find_pool(node->doc))
+    {
+      last_allocated = pool->allocate();
+      return last_allocated;
+    }
+  }
+
+  auto memory = static_cast<unsigned char*>(::operator new(WrapperPool::heap_header_size + size));
+  auto wrapper = memory + WrapperPool::heap_header_size;
+  WrapperPool::pool_of(wrapper) = nullptr;
+  return wrapper;
+}
+
+void deallocate_wrapper(void* wrapper) noexcept
+{
+  if (!wrapper)
+    return;
+
+  if (auto pool = WrapperPool::pool_of(wrapper))
+    pool->deallocate(wrapper);
+  else
+    ::operator delete(static_cast<unsigned char*>(wrapper) - WrapperPool::heap_header_size);
+}
+
+// Called when a C++ wrapper of node has been constructed.
+void on_wrapper_created(const xmlpp::Node* wrapper, const xmlNode* node)
+{
+  const auto expected = last_allocated;
+  last_allocated = nullptr;
+  if (wrapper == expected || !node->doc || node->type == XML_DOCUMENT_NODE ||
+      node->type == XML_HTML_DOCUMENT_NODE)
+    return;
+
+  if (auto pool = find_pool(node->doc))
+    pool->has_other_wrappers = true;
+}
+
+// Whether a node, or any of its descendants or attributes, has a C++ wrapper.
+// Compare Node::free_wrappers().
+bool has_wrappers(const xmlNode* node)
+{
+  if (node->type != XML_DOCUMENT_NODE && node->type != XML_HTML_DOCUMENT_NODE &&
+      node->type != XML_DTD_NODE && node->_private)
+    return true;
+
+  if (node->type != XML_ENTITY_REF_NODE)
+  {
+    for (auto child = node->children; child; child = child->next)
+      if (has_wrappers(child))
+        return true;
+  }
+
+  switch (node->type)
+  {
+    case XML_DTD_NODE:
+    case XML_ATTRIBUTE_NODE:
+    case XML_ELEMENT_DECL:
+    case XML_ATTRIBUTE_DECL:
+    case XML_ENTITY_DECL:
+    case XML_DOCUMENT_NODE:
+    case XML_HTML_DOCUMENT_NODE:
+      return false;
+    default:
+      break;
+  }
+
+  for (auto attr = node->properties; attr; attr = attr->next)
+    if (has_wrappers(reinterpret_cast<const xmlNode*>(attr)))
+      return true;
+  return false;
+}
+
 } // anonymous namespace
 
 namespace xmlpp
@@ -271,11 +486,32 @@ Node::Node(xmlNode* node)
     throw internal_error("xmlNode pointer cannot be nullptr");
 
   impl_->_private = this;
+  on_wrapper_created(this, impl_);
 }
 
 Node::~Node()
 {}
 
+void* Node::operator new(std::size_t size)
+{
+  return allocate_wrapper(size, nullptr);
+}
+
+void* Node::operator new(std::size_t size, xmlNode* node)
+{
+  return allocate_wrapper(size, node);
+}
+
+void Node::operator delete(void* wrapper) noexcept
+{
+  deallocate_wrapper(wrapper);
+}
+
+void Node::operator delete(void* wrapper, xmlNode* /* node */) noexcept
+{
+  deallocate_wrapper(wrapper);
+}
+
 const Element* Node::get_parent() const
 {
   return const_cast<Node*>(this)->get_parent();
@@ -349,6 +585,36 @@ Node::const_NodeList Node::get_children(const ustring& name) const
   return get_children_common<const_NodeList>(name, impl_->children);
 }
 
+NodeRange<Node*> Node::children()
+{
+  return NodeRange<Node*>(impl_, NodeRangeBase::Axis::CHILDREN);
+}
+
+NodeRange<const Node*> Node::children() const
+{
+  return NodeRange<const Node*>(impl_, NodeRangeBase::Axis::CHILDREN);
+}
+
+NodeRange<Element*> Node::child_elements(const ustring& name)
+{
+  return NodeRange<Element*>(impl_, NodeRangeBase::Axis::CHILDREN, true, name);
+}
+
+NodeRange<const Element*> Node::child_elements(const ustring& name) const
+{
+  return NodeRange<const Element*>(impl_, NodeRangeBase::Axis::CHILDREN, true, name);
+}
+
+NodeRange<Node*> Node::descendants()
+{
+  return NodeRange<Node*>(impl_, NodeRangeBase::Axis::DESCENDANTS);
+}
+
+NodeRange<const Node*> Node::descendants() const
+{
+  return NodeRange<const Node*>(impl_, NodeRangeBase::Axis::DESCENDANTS);
+}
+
 //static
 void Node::remove_node(Node* node)
 {
@@ -463,67 +729,204 @@ std::optional<ustring> Node::get_path2() const
 
 Node::NodeSet Node::find(const ustring& xpath)
 {
-  return find_common<NodeSet>(xpath, nullptr, impl_);
+  return find_common<NodeSet>(find_common1(xpath, nullptr, impl_));
 }
 
 Node::const_NodeSet Node::find(const ustring& xpath) const
 {
-  return find_common<const_NodeSet>(xpath, nullptr, impl_);
+  return find_common<const_NodeSet>(find_common1(xpath, nullptr, impl_));
 }
 
 Node::NodeSet Node::find(const ustring& xpath, const PrefixNsMap& namespaces)
 {
-  return find_common<NodeSet>(xpath, &namespaces, impl_);
+  return find_common<NodeSet>(find_common1(xpath, &namespaces, impl_));
 }
 
 Node::const_NodeSet Node::find(const ustring& xpath, const PrefixNsMap& namespaces) const
 {
-  return find_common<const_NodeSet>(xpath, &namespaces, impl_);
+  return find_common<const_NodeSet>(find_common1(xpath, &namespaces, impl_));
 }
 
 std::variant<Node::NodeSet, bool, double, ustring>
 Node::eval_xpath(const ustring& xpath, const PrefixNsMap& namespaces)
 {
-  return eval_xpath_common<NodeSet>(xpath, &namespaces, impl_);
+  return eval_xpath_common<NodeSet>(find_common1(xpath, &namespaces, impl_));
 }
 
 std::variant<Node::const_NodeSet, bool, double, ustring>
 Node::eval_xpath(const ustring& xpath, const PrefixNsMap& namespaces) const
 {
-  return eval_xpath_common<const_NodeSet>(xpath, &namespaces, impl_);
+  return eval_xpath_common<const_NodeSet>(find_common1(xpath, &namespaces, impl_));
 }
 
 bool Node::eval_to_boolean(const ustring& xpath, XPathResultType* result_type) const
 {
-  return eval_common_to_boolean(xpath, nullptr, result_type, impl_);
+  return eval_common_to_boolean(eval_common(xpath, nullptr, result_type, impl_));
 }
 
 bool Node::eval_to_boolean(const ustring& xpath, const PrefixNsMap& namespaces,
   XPathResultType* result_type) const
 {
-  return eval_common_to_boolean(xpath, &namespaces, result_type, impl_);
+  return eval_common_to_boolean(eval_common(xpath, &namespaces, result_type, impl_));
 }
 
 double Node::eval_to_number(const ustring& xpath, XPathResultType* result_type) const
 {
-  return eval_common_to_number(xpath, nullptr, result_type, impl_);
+  return eval_common_to_number(eval_common(xpath, nullptr, result_type, impl_));
 }
 
 double Node::eval_to_number(const ustring& xpath, const PrefixNsMap& namespaces,
   XPathResultType* result_type) const
 {
-  return eval_common_to_number(xpath, &namespaces, result_type, impl_);
+  return eval_common_to_number(eval_common(xpath, &namespaces, result_type, impl_));
 }
 
 ustring Node::eval_to_string(const ustring& xpath, XPathResultType* result_type) const
 {
-  return eval_common_to_string(xpath, nullptr, result_type, impl_);
+  return eval_common_to_string(eval_common(xpath, nullptr, result_type, impl_));
 }
 
 ustring Node::eval_to_string(const ustring& xpath, const PrefixNsMap& namespaces,
   XPathResultType* result_type) const
 {
-  return eval_common_to_string(xpath, &namespaces, result_type, impl_);
+  return eval_common_to_string(eval_common(xpath, &namespaces, result_type, impl_));
+}
+
+Node::NodeSet Node::find(const XPathExpression& xpath, XPathContext& context)
+{
+  return find_common<NodeSet>(check_compiled_result(context.evaluate(xpath, impl_), xpath));
+}
+
+Node::const_NodeSet Node::find(const XPathExpression& xpath, XPathContext& context) const
+{
+  return find_common<const_NodeSet>(check_compiled_result(context.evaluate(xpath, impl_), xpath));
+}
+
+std::variant<Node::NodeSet, bool, double, ustring>
+Node::eval_xpath(const XPathExpression& xpath, XPathContext& context)
+{
+  return eval_xpath_common<NodeSet>(check_compiled_result(context.evaluate(xpath, impl_), xpath));
+}
+
+std::variant<Node::const_NodeSet, bool, double, ustring>
+Node::eval_xpath(const XPathExpression& xpath, XPathContext& context) const
+{
+  return eval_xpath_common<const_NodeSet>(check_compiled_result(context.evaluate(xpath, impl_), xpath));
+}
+
+bool Node::eval_to_boolean(const XPathExpression& xpath, XPathContext& context,
+  XPathResultType* result_type) const
+{
+  return eval_common_to_boolean(eval_common2(context.evaluate(xpath, impl_),
+    xpath.get_expression(), result_type));
+}
+
+double Node::eval_to_number(const XPathExpression& xpath, XPathContext& context,
+  XPathResultType* result_type) const
+{
+  return eval_common_to_number(eval_common2(context.evaluate(xpath, impl_),
+    xpath.get_expression(), result_type));
+}
+
+ustring Node::eval_to_string(const XPathExpression& xpath, XPathContext& context,
+  XPathResultType* result_type) const
+{
+  return eval_common_to_string(eval_common2(context.evaluate(xpath, impl_),
+    xpath.get_expression(), result_type));
+}
+
+Node* Node::find_first(const ustring& xpath, const PrefixNsMap& namespaces)
+{
+  XPathContext context(namespaces);
+  return find_first(XPathExpression(xpath), context);
+}
+
+const Node* Node::find_first(const ustring& xpath, const PrefixNsMap& namespaces) const
+{
+  return const_cast<Node*>(this)->find_first(xpath, namespaces);
+}
+
+Node* Node::find_first(const XPathExpression& xpath, XPathContext& context)
+{
+  auto result = check_compiled_result(context.evaluate(xpath, impl_), xpath);
+  auto nodeset = get_nodeset(result);
+
+  // The node-set is in document order.
+  Node* node = nullptr;
+  for (int i = 0; nodeset && i < nodeset->nodeNr && !node; ++i)
+  {
+    // Compare find_common2().
+    auto cnode = nodeset->nodeTab[i];
+    if (cnode && cnode->type != XML_NAMESPACE_DECL)
+      node = _convert_node(cnode);
+  }
+  xmlXPathFreeObject(result);
+  return node;
+}
+
+const Node* Node::find_first(const XPathExpression& xpath, XPathContext& context) const
+{
+  return const_cast<Node*>(this)->find_first(xpath, context);
+}
+
+bool Node::exists(const ustring& xpath, const PrefixNsMap& namespaces) const
+{
+  XPathContext context(namespaces);
+  return exists(XPathExpression(xpath), context);
+}
+
+bool Node::exists(const XPathExpression& xpath, XPathContext& context) const
+{
+  const int result = context.evaluate_to_boolean(xpath, impl_);
+  if (result < 0)
+    throw exception("Invalid XPath: " + xpath.get_expression());
+  return result != 0;
+}
+
+std::size_t Node::count(const ustring& xpath, const PrefixNsMap& namespaces) const
+{
+  XPathContext context(namespaces);
+  return count(XPathExpression(xpath), context);
+}
+
+std::size_t Node::count(const XPathExpression& xpath, XPathContext& context) const
+{
+  auto result = check_compiled_result(context.evaluate(xpath, impl_), xpath);
+  auto nodeset = get_nodeset(result);
+
+  std::size_t n_nodes = 0;
+  for (int i = 0; nodeset && i < nodeset->nodeNr; ++i)
+  {
+    // Compare find_common2().
+    auto cnode = nodeset->nodeTab[i];
+    if (cnode && cnode->type != XML_NAMESPACE_DECL)
+      ++n_nodes;
+  }
+  xmlXPathFreeObject(result);
+  return n_nodes;
+}
+
+XPathNodeSet<Node*> Node::select(const ustring& xpath, const PrefixNsMap& namespaces)
+{
+  XPathContext context(namespaces);
+  return select(XPathExpression(xpath), context);
+}
+
+XPathNodeSet<const Node*> Node::select(const ustring& xpath, const PrefixNsMap& namespaces) const
+{
+  return XPathNodeSet<const Node*>(const_cast<Node*>(this)->select(xpath, namespaces));
+}
+
+XPathNodeSet<Node*> Node::select(const XPathExpression& xpath, XPathContext& context)
+{
+  auto result = check_compiled_result(context.evaluate(xpath, impl_), xpath);
+  get_nodeset(result);
+  return XPathNodeSet<Node*>(result);
+}
+
+XPathNodeSet<const Node*> Node::select(const XPathExpression& xpath, XPathContext& context) const
+{
+  return XPathNodeSet<const Node*>(const_cast<Node*>(this)->select(xpath, context));
 }
 
 #ifndef LIBXMLXX_DISABLE_DEPRECATED
@@ -616,41 +1019,43 @@ void Node::create_wrapper(xmlNode* node)
     return;
   }
 
+  // new (node) allocates the wrapper from the memory pool of the Document
+  // that owns node. See Node::operator new().
   switch (node->type)
   {
     case XML_ELEMENT_NODE:
     {
-      node->_private = new xmlpp::Element(node);
+      node->_private = new (node) xmlpp::Element(node);
       break;
     }
     case XML_ATTRIBUTE_NODE:
     {
-      node->_private = new xmlpp::AttributeNode(node);
+      node->_private = new (node) xmlpp::AttributeNode(node);
       break;
     }
     case XML_ATTRIBUTE_DECL:
     {
-      node->_private = new xmlpp::AttributeDeclaration(node);
+      node->_private = new (node) xmlpp::AttributeDeclaration(node);
       break;
     }
     case XML_TEXT_NODE:
     {
-      node->_private = new xmlpp::TextNode(node);
+      node->_private = new (node) xmlpp::TextNode(node);
       break;
     }
     case XML_COMMENT_NODE:
     {
-      node->_private = new xmlpp::CommentNode(node);
+      node->_private = new (node) xmlpp::CommentNode(node);
       break;
     }
     case XML_CDATA_SECTION_NODE:
     {
-      node->_private = new xmlpp::CdataNode(node);
+      node->_private = new (node) xmlpp::CdataNode(node);
       break;
     }
     case XML_PI_NODE:
     {
-      node->_private = new xmlpp::ProcessingInstructionNode(node);
+      node->_private = new (node) xmlpp::ProcessingInstructionNode(node);
       break;
     }
     case XML_DTD_NODE:
@@ -666,22 +1071,22 @@ void Node::create_wrapper(xmlNode* node)
     //}
     case XML_ENTITY_DECL:
     {
-      node->_private = new xmlpp::EntityDeclaration(node);
+      node->_private = new (node) xmlpp::EntityDeclaration(node);
       break;
     }
     case XML_ENTITY_REF_NODE:
     {
-      node->_private = new xmlpp::EntityReference(node);
+      node->_private = new (node) xmlpp::EntityReference(node);
       break;
     }
     case XML_XINCLUDE_START:
     {
-      node->_private = new xmlpp::XIncludeStart(node);
+      node->_private = new (node) xmlpp::XIncludeStart(node);
       break;
     }
     case XML_XINCLUDE_END:
     {
-      node->_private = new xmlpp::XIncludeEnd(node);
+      node->_private = new (node) xmlpp::XIncludeEnd(node);
       break;
     }
     case XML_DOCUMENT_NODE:
@@ -693,7 +1098,7 @@ void Node::create_wrapper(xmlNode* node)
     default:
     {
       // good default for release versions
-      node->_private = new xmlpp::Node(node);
+      node->_private = new (node) xmlpp::Node(node);
       std::cerr << "xmlpp::Node::create_wrapper(): Warning: new node of unknown type created: "
                 << node->type << std::endl;
       break;
@@ -752,4 +1157,53 @@ void Node::free_wrappers(xmlNode* node)
     free_wrappers(reinterpret_cast<xmlNode*>(attr));
 }
 
+//static
+void Node::create_wrapper_pool(xmlDoc* doc, bool check_wrappers)
+{
+  auto pool = std::make_unique<WrapperPool>();
+  // Wrappers that were created before the Document, on the heap, are
+  // deleted one by one, so their destructors are called.
+  if (check_wrappers && has_wrappers(reinterpret_cast<const xmlNode*>(doc)))
+    pool->has_other_wrappers = true;
+
+  std::lock_guard<std::mutex> lock(pools_mutex);
+  pools[doc] = std::move(pool);
+  ++pools_generation;
+}
+
+//static
+void Node::free_wrapper_pool(xmlDoc* doc)
+{
+  std::unique_ptr<WrapperPool> pool;
+  {
+    std::lock_guard<std::mutex> lock(pools_mutex);
+    const auto iter = pools.find(doc);
+    if (iter != pools.end())
+    {
+      pool = std::move(iter->second);
+      pools.erase(iter);
+      ++pools_generation;
+    }
+  }
+
+  if (!pool || pool->has_other_wrappers)
+  {
+    // The deleted wrappers that were allocated from the pool are returned to
+    // the pool, which still exists.
+    free_wrappers(reinterpret_cast<xmlNode*>(doc));
+    return;
+  }
+
+  // All wrappers except the Dtd wrappers are freed with the memory pool,
+  // without visiting the nodes. Destruction of the wrappers is a no-op.
+  for (auto dtd : { doc->intSubset, doc->extSubset })
+  {
+    if (dtd && dtd->_private)
+    {
+      delete static_cast<Dtd*>(dtd->_private);
+      dtd->_private = nullptr;
+    }
+  }
+}
+
 } //namespace xmlpp
@@ -10,6 +10,9 @@
 #include <libxml++/noncopyable.h>
 #include <libxml++/exceptions/exception.h>
 #include "libxml++/ustring.h"
+#include <libxml++/nodes/noderange.h>
+#include <libxml++/xpathnodeset.h>
+#include <cstddef> // std::size_t
 #include <list>
 #include <map>
 #include <optional>
@@ -19,6 +22,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 extern "C" {
   struct _xmlNode;
+  struct _xmlDoc;
 }
 #endif //DOXYGEN_SHOULD_SKIP_THIS
 
@@ -26,6 +30,8 @@ namespace xmlpp
 {
 
 class LIBXMLPP_API Element;
+class XPathContext;
+class XPathExpression;
 
 // xmlpp::XPathResultType is similar to xmlXPathObjectType in libxml2.
 /** An XPath expression is evaluated to yield a result, which
@@ -69,6 +75,40 @@ public:
    */
   ~Node() override;
 
+  /** Allocate a C++ wrapper on the heap.
+   * A C++ wrapper can be replaced by deleting it, and creating an instance
+   * of a class derived from Node, which is then owned by the Document.
+   * That works whether the deleted wrapper was allocated from the Document's
+   * memory pool, as wrappers that libxml++ creates are, or on the heap.
+   *
+   * @newin{5,8}
+   */
+  static void* operator new(std::size_t size);
+
+  /** Allocate a C++ wrapper of @a node, from the memory pool of the Document
+   * that owns the node, if there is such a Document. Otherwise on the heap.
+   *
+   * The memory pool is locked, so wrappers of the nodes of a const Document
+   * can be created by several threads at the same time.
+   *
+   * This is only for use by the libxml++ implementation.
+   *
+   * @newin{5,8}
+   */
+  static void* operator new(std::size_t size, _xmlNode* node);
+
+  /** Free a C++ wrapper, that was allocated by any of the operator new() functions.
+   *
+   * @newin{5,8}
+   */
+  static void operator delete(void* wrapper) noexcept;
+
+  /** Free a C++ wrapper, if its constructor throws.
+   *
+   * @newin{5,8}
+   */
+  static void operator delete(void* wrapper, _xmlNode* node) noexcept;
+
 #ifndef LIBXMLXX_DISABLE_DEPRECATED
   /** Get the name of this node.
    * @returns The node's name.
@@ -186,6 +226,58 @@ public:
    */
   const_NodeList get_children(const ustring& name = ustring()) const;
 
+  /** Get a lazy range of the child nodes.
+   * Unlike get_children(), this does not build a list. The C++ wrappers of
+   * the child nodes are created while iterating over the range.
+   * @returns A range of the child nodes.
+   *
+   * @newin{5,8}
+   */
+  NodeRange<Node*> children();
+
+  /** Get a lazy range of the child nodes.
+   * Unlike get_children(), this does not build a list. The C++ wrappers of
+   * the child nodes are created while iterating over the range.
+   * @returns A range of the child nodes.
+   *
+   * @newin{5,8}
+   */
+  NodeRange<const Node*> children() const;
+
+  /** Get a lazy range of the child elements.
+   * @param name The name of the child elements, or an empty string for all child elements.
+   * @returns A range of the child elements.
+   *
+   * @newin{5,8}
+   */
+  NodeRange<Element*> child_elements(const ustring& name = ustring());
+
+  /** Get a lazy range of the child elements.
+   * @param name The name of the child elements, or an empty string for all child elements.
+   * @returns A range of the child elements.
+   *
+   * @newin{5,8}
+   */
+  NodeRange<const Element*> child_elements(const ustring& name = ustring()) const;
+
+  /** Get a lazy range of the descendant nodes, in document order.
+   * Only the children of element nodes are descendants, apart from the children
+   * of this node. Attributes are not descendants.
+   * @returns A range of the descendant nodes.
+   *
+   * @newin{5,8}
+   */
+  NodeRange<Node*> descendants();
+
+  /** Get a lazy range of the descendant nodes, in document order.
+   * Only the children of element nodes are descendants, apart from the children
+   * of this node. Attributes are not descendants.
+   * @returns A range of the descendant nodes.
+   *
+   * @newin{5,8}
+   */
+  NodeRange<const Node*> descendants() const;
+
   /** Remove a node and its children.
    *
    * The node is disconnected from its parent. The underlying libxml xmlNode
@@ -376,6 +468,246 @@ public:
   ustring eval_to_string(const ustring& xpath, const PrefixNsMap& namespaces,
     XPathResultType* result_type = nullptr) const;
 
+  /** Find nodes from a compiled XPath expression.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The resulting NodeSet.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  NodeSet find(const XPathExpression& xpath, XPathContext& context);
+
+  /** Find nodes from a compiled XPath expression.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The resulting const_NodeSet.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  const_NodeSet find(const XPathExpression& xpath, XPathContext& context) const;
+
+  /** Evaluate a compiled XPath expression.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The resulting NodeSet (XPathResultType::NODESET), bool (XPathResultType::BOOLEAN),
+   *          double (XPathResultType::NUMBER) or ustring (XPathResultType::STRING).
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset, boolean, number or string.
+   *
+   * @newin{5,8}
+   */
+  std::variant<NodeSet, bool, double, ustring>
+  eval_xpath(const XPathExpression& xpath, XPathContext& context);
+
+  /** Evaluate a compiled XPath expression.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The resulting const_NodeSet (XPathResultType::NODESET), bool (XPathResultType::BOOLEAN),
+   *          double (XPathResultType::NUMBER) or ustring (XPathResultType::STRING).
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset, boolean, number or string.
+   *
+   * @newin{5,8}
+   */
+  std::variant<const_NodeSet, bool, double, ustring>
+  eval_xpath(const XPathExpression& xpath, XPathContext& context) const;
+
+  /** Evaluate a compiled XPath expression.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @param[out] result_type Result type of the XPath expression before conversion
+   *             to boolean. If <tt>nullptr</tt>, the result type is not returned.
+   * @returns The value of the XPath expression. If the value is not of type boolean,
+   *          it is converted to boolean.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   *
+   * @newin{5,8}
+   */
+  bool eval_to_boolean(const XPathExpression& xpath, XPathContext& context,
+    XPathResultType* result_type = nullptr) const;
+
+  /** Evaluate a compiled XPath expression.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @param[out] result_type Result type of the XPath expression before conversion
+   *             to number. If <tt>nullptr</tt>, the result type is not returned.
+   * @returns The value of the XPath expression. If the value is not of type number,
+   *          it is converted to number.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   *
+   * @newin{5,8}
+   */
+  double eval_to_number(const XPathExpression& xpath, XPathContext& context,
+    XPathResultType* result_type = nullptr) const;
+
+  /** Evaluate a compiled XPath expression.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @param[out] result_type Result type of the XPath expression before conversion
+   *             to string. If <tt>nullptr</tt>, the result type is not returned.
+   * @returns The value of the XPath expression. If the value is not of type string,
+   *          it is converted to string.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   *
+   * @newin{5,8}
+   */
+  ustring eval_to_string(const XPathExpression& xpath, XPathContext& context,
+    XPathResultType* result_type = nullptr) const;
+
+  /** Find the first node from an XPath expression.
+   * libxml2 still evaluates the whole node-set, but only the first node gets
+   * a C++ wrapper, and no NodeSet vector is filled.
+   * @param xpath The XPath of the nodes.
+   * @param namespaces A map of namespace prefixes to namespace URIs to be used while finding.
+   * @returns The first node in document order, or <tt>nullptr</tt> if no node is found.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  Node* find_first(const ustring& xpath, const PrefixNsMap& namespaces = {});
+
+  /** Find the first node from an XPath expression.
+   * libxml2 still evaluates the whole node-set, but only the first node gets
+   * a C++ wrapper, and no NodeSet vector is filled.
+   * @param xpath The XPath of the nodes.
+   * @param namespaces A map of namespace prefixes to namespace URIs to be used while finding.
+   * @returns The first node in document order, or <tt>nullptr</tt> if no node is found.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  const Node* find_first(const ustring& xpath, const PrefixNsMap& namespaces = {}) const;
+
+  /** Find the first node from a compiled XPath expression.
+   * libxml2 still evaluates the whole node-set, but only the first node gets
+   * a C++ wrapper, and no NodeSet vector is filled.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The first node in document order, or <tt>nullptr</tt> if no node is found.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  Node* find_first(const XPathExpression& xpath, XPathContext& context);
+
+  /** Find the first node from a compiled XPath expression.
+   * libxml2 still evaluates the whole node-set, but only the first node gets
+   * a C++ wrapper, and no NodeSet vector is filled.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The first node in document order, or <tt>nullptr</tt> if no node is found.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  const Node* find_first(const XPathExpression& xpath, XPathContext& context) const;
+
+  /** Find out if an XPath expression finds any node.
+   * libxml2 stops the evaluation at the first node, if the last step of the
+   * location path has no predicate. No C++ wrappers are created.
+   * @param xpath The XPath of the nodes.
+   * @param namespaces A map of namespace prefixes to namespace URIs to be used while finding.
+   * @returns Whether a node is found. If the result of the expression is not
+   *          a node-set, it's converted to boolean, like eval_to_boolean() does.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   *
+   * @newin{5,8}
+   */
+  bool exists(const ustring& xpath, const PrefixNsMap& namespaces = {}) const;
+
+  /** Find out if a compiled XPath expression finds any node.
+   * libxml2 stops the evaluation at the first node, if the last step of the
+   * location path has no predicate. No C++ wrappers are created.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns Whether a node is found. If the result of the expression is not
+   *          a node-set, it's converted to boolean, like eval_to_boolean() does.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   *
+   * @newin{5,8}
+   */
+  bool exists(const XPathExpression& xpath, XPathContext& context) const;
+
+  /** Count the nodes that an XPath expression finds.
+   * No C++ wrappers are created.
+   * @param xpath The XPath of the nodes.
+   * @param namespaces A map of namespace prefixes to namespace URIs to be used while finding.
+   * @returns The number of nodes, the same as <tt>find(xpath, namespaces).size()</tt>.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  std::size_t count(const ustring& xpath, const PrefixNsMap& namespaces = {}) const;
+
+  /** Count the nodes that a compiled XPath expression finds.
+   * No C++ wrappers are created.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The number of nodes, the same as <tt>find(xpath, context).size()</tt>.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  std::size_t count(const XPathExpression& xpath, XPathContext& context) const;
+
+  /** Find nodes from an XPath expression, without converting them in advance.
+   * Unlike find(), this creates no C++ wrappers and no vector of nodes. See XPathNodeSet.
+   * @param xpath The XPath of the nodes.
+   * @param namespaces A map of namespace prefixes to namespace URIs to be used while finding.
+   * @returns The resulting nodes.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  XPathNodeSet<Node*> select(const ustring& xpath, const PrefixNsMap& namespaces = {});
+
+  /** Find nodes from an XPath expression, without converting them in advance.
+   * Unlike find(), this creates no C++ wrappers and no vector of nodes. See XPathNodeSet.
+   * @param xpath The XPath of the nodes.
+   * @param namespaces A map of namespace prefixes to namespace URIs to be used while finding.
+   * @returns The resulting nodes.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  XPathNodeSet<const Node*> select(const ustring& xpath, const PrefixNsMap& namespaces = {}) const;
+
+  /** Find nodes from a compiled XPath expression, without converting them in advance.
+   * Unlike find(), this creates no C++ wrappers and no vector of nodes. See XPathNodeSet.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The resulting nodes.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  XPathNodeSet<Node*> select(const XPathExpression& xpath, XPathContext& context);
+
+  /** Find nodes from a compiled XPath expression, without converting them in advance.
+   * Unlike find(), this creates no C++ wrappers and no vector of nodes. See XPathNodeSet.
+   * @param xpath The compiled XPath expression.
+   * @param context The context to evaluate the expression in.
+   * @returns The resulting nodes.
+   * @throws xmlpp::exception If the XPath expression cannot be evaluated.
+   * @throws xmlpp::internal_error If the result type is not nodeset.
+   *
+   * @newin{5,8}
+   */
+  XPathNodeSet<const Node*> select(const XPathExpression& xpath, XPathContext& context) const;
+
   ///Access the underlying libxml implementation.
   _xmlNode* cobj() noexcept;
 
@@ -398,6 +730,29 @@ public:
    */
   static void free_wrappers(_xmlNode* node);
 
+  /** Allocate the C++ instances for the nodes of a document from a memory pool.
+   *
+   * This is only for use by the libxml++ implementation.
+   *
+   * @newin{5,8}
+   *
+   * @param doc The document, whose Document is being constructed.
+   * @param check_wrappers Whether the document may already have C++ instances
+   *        for some of its nodes. If true, all nodes are visited to find them.
+   */
+  static void create_wrapper_pool(_xmlDoc* doc, bool check_wrappers = true);
+
+  /** Delete the C++ instances for all nodes of a document, except the
+   * document node, and the memory pool created by create_wrapper_pool().
+   *
+   * This is only for use by the libxml++ implementation.
+   *
+   * @newin{5,8}
+   *
+   * @param doc The document, whose Document is being destroyed.
+   */
+  static void free_wrapper_pool(_xmlDoc* doc);
+
 private:
   _xmlNode* impl_;
 };
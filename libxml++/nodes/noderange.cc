@@ -0,0 +1,113 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/nodes/noderange.h>
+#include <libxml++/nodes/element.h>
+
+#include <libxml/tree.h>
+
+#include <cstring>
+
+namespace xmlpp
+{
+
+NodeRangeBase::NodeRangeBase(const _xmlNode* node, Axis axis, bool elements_only,
+  std::string_view name)
+: node_(const_cast<xmlNode*>(node)),
+  axis_(axis),
+  elements_only_(elements_only),
+  name_(name)
+{
+  // xmlDictExists() does not add the name to the dictionary. If the name is
+  // not there, no node has an interned name that is equal to it.
+  if (!name_.empty() && node_ && node_->doc && node_->doc->dict)
+    interned_name_ = xmlDictExists(node_->doc->dict, (const xmlChar*)name_.data(),
+      static_cast<int>(name_.size()));
+}
+
+bool NodeRangeBase::matches(const xmlNode* node) const noexcept
+{
+  if (elements_only_ && node->type != XML_ELEMENT_NODE)
+    return false;
+  if (name_.empty())
+    return true;
+  if (!node->name)
+    return false;
+  // The parser interns all element names. Nodes created with the API may have
+  // names that are not interned, so a different address is not conclusive.
+  if (node->name == interned_name_)
+    return true;
+  return std::strcmp((const char*)node->name, name_.c_str()) == 0;
+}
+
+xmlNode* NodeRangeBase::advance(const xmlNode* node) const noexcept
+{
+  if (axis_ == Axis::DESCENDANTS)
+  {
+    if (node->type == XML_ELEMENT_NODE && node->children)
+      return node->children;
+    // Go up until a node with a next sibling is found, but not above node_.
+    for (; node != node_; node = node->parent)
+      if (node->next)
+        return node->next;
+    return nullptr;
+  }
+  return node->next;
+}
+
+xmlNode* NodeRangeBase::next_match(xmlNode* node) const noexcept
+{
+  while (node && !matches(node))
+    node = advance(node);
+  return node;
+}
+
+xmlNode* NodeRangeBase::first() const noexcept
+{
+  if (!node_ || node_->type == XML_ENTITY_REF_NODE)
+    return nullptr;
+  return next_match(node_->children);
+}
+
+xmlNode* NodeRangeBase::next(const xmlNode* node) const noexcept
+{
+  return next_match(advance(node));
+}
+
+//static
+Node* NodeConverter::get_wrapper(xmlNode* node)
+{
+  Node::create_wrapper(node);
+  return static_cast<Node*>(node->_private);
+}
+
+//static
+Element* NodeConverter::get_element_wrapper(xmlNode* node)
+{
+  if (!is_element(node))
+    return nullptr;
+  return static_cast<Element*>(get_wrapper(node));
+}
+
+//static
+bool NodeConverter::is_element(const xmlNode* node) noexcept
+{
+  return node->type == XML_ELEMENT_NODE;
+}
+
+} // namespace xmlpp
@@ -0,0 +1,204 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_NODES_NODERANGE_H
+#define __LIBXMLPP_NODES_NODERANGE_H
+
+#include <libxml++config.h>
+#include <libxml++/ustring.h>
+
+#include <cstddef> // std::ptrdiff_t
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlNode;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp
+{
+class Node;
+class Element;
+class ElementRef;
+
+/** Conversion of libxml2 nodes to the value types of NodeRange and XPathNodeSet.
+ *
+ * @newin{5,8}
+ */
+class LIBXMLPP_API NodeConverter
+{
+public:
+  /** Convert a node.
+   * @tparam T <tt>Node*</tt>, <tt>const Node*</tt>, <tt>Element*</tt>,
+   *           <tt>const Element*</tt>, NodeRef or ElementRef.
+   * @param node A node.
+   * @returns The C++ wrapper of the node, which is created if it does not exist,
+   *          or a reference to the node. If T is an Element pointer or
+   *          ElementRef, and the node is not an element, <tt>nullptr</tt>
+   *          or an ElementRef that refers to no node.
+   */
+  template <typename T>
+  static T convert(_xmlNode* node)
+  {
+    using Value = std::remove_const_t<std::remove_pointer_t<T>>;
+    if constexpr (std::is_same_v<Value, Node>)
+      return get_wrapper(node);
+    else if constexpr (std::is_same_v<Value, Element>)
+      return get_element_wrapper(node);
+    else if constexpr (std::is_same_v<T, ElementRef>)
+      return is_element(node) ? T(node) : T();
+    else
+      return T(node);
+  }
+
+  /** Whether values of type T give write access to the nodes.
+   * Only <tt>Node*</tt> and <tt>Element*</tt> do.
+   */
+  template <typename T>
+  static constexpr bool is_writable =
+    std::is_pointer_v<T> && !std::is_const_v<std::remove_pointer_t<T>>;
+
+  /// Get or create the C++ wrapper of a node.
+  static Node* get_wrapper(_xmlNode* node);
+
+  /// Get or create the C++ wrapper of an element node, or get <tt>nullptr</tt>.
+  static Element* get_element_wrapper(_xmlNode* node);
+
+  /// Whether the node is an element node.
+  static bool is_element(const _xmlNode* node) noexcept;
+};
+
+/** The part of NodeRange that does not depend on the value type.
+ *
+ * @newin{5,8}
+ */
+class LIBXMLPP_API NodeRangeBase
+{
+public:
+  /// The nodes that a range visits.
+  enum class Axis
+  {
+    CHILDREN,   ///< The children of a node.
+    DESCENDANTS ///< The descendants of a node, in document order.
+  };
+
+  /** Create a range.
+   * Only the children of element nodes are descendants. The children of an
+   * entity reference node are not visited.
+   * @param node The node whose children or descendants are visited, or <tt>nullptr</tt>.
+   * @param axis The nodes that are visited.
+   * @param elements_only Whether only element nodes are visited.
+   * @param name Only nodes with this name are visited, or all nodes if empty.
+   */
+  NodeRangeBase(const _xmlNode* node, Axis axis, bool elements_only = false,
+    std::string_view name = std::string_view());
+
+  /// The first node of the range, or <tt>nullptr</tt>.
+  _xmlNode* first() const noexcept;
+
+  /// The node after @a node in the range, or <tt>nullptr</tt>.
+  _xmlNode* next(const _xmlNode* node) const noexcept;
+
+private:
+  bool matches(const _xmlNode* node) const noexcept;
+  _xmlNode* next_match(_xmlNode* node) const noexcept;
+  _xmlNode* advance(const _xmlNode* node) const noexcept;
+
+  _xmlNode* node_;
+  Axis axis_;
+  bool elements_only_;
+  ustring name_;
+  // The name, interned in the document's dictionary, or nullptr.
+  const unsigned char* interned_name_ = nullptr;
+};
+
+/** A lazy range of nodes, for use in a range-based for loop.
+ *
+ * The range walks libxml2's sibling and child pointers. Nothing is allocated
+ * while iterating, except for the C++ wrappers of the visited nodes, if the
+ * value type is a pointer to a Node or Element. Values of type NodeRef or
+ * ElementRef don't need wrappers:
+ * @code
+ * for (auto child : element->child_elements("item"))
+ *   std::cout << child->get_attribute_value2("id").value_or("") << std::endl;
+ * @endcode
+ *
+ * Names are compared by address if they are interned in the document's
+ * dictionary, else by their characters.
+ *
+ * An iterator refers to the range that created it, and must not outlive it.
+ * The range must not be used after the tree has been changed, except that
+ * the node of the current iteration may be changed or removed after the
+ * iterator has been incremented past it.
+ *
+ * @tparam T The value type: <tt>Node*</tt>, <tt>const Node*</tt>, <tt>Element*</tt>,
+ *           <tt>const Element*</tt>, NodeRef or ElementRef.
+ *
+ * @newin{5,8}
+ */
+template <typename T>
+class NodeRange : public NodeRangeBase
+{
+public:
+  class iterator
+  {
+  public:
+    // The values are created when the iterator is dereferenced, so reference
+    // is not a reference type, which a forward iterator requires.
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = T;
+
+    iterator() noexcept = default;
+    iterator(const NodeRange* range, _xmlNode* node) noexcept
+      : range_(range), node_(node)
+      {
+      }
+
+    T operator*() const { return NodeConverter::convert<T>(node_); }
+    iterator& operator++() noexcept { node_ = range_->next(node_); return *this; }
+    iterator operator++(int) noexcept { auto tmp = *this; node_ = range_->next(node_); return tmp; }
+    bool operator==(const iterator& other) const noexcept { return node_ == other.node_; }
+    bool operator!=(const iterator& other) const noexcept { return node_ != other.node_; }
+
+    ///Access the underlying libxml implementation.
+    _xmlNode* cobj() const noexcept { return node_; }
+
+  private:
+    const NodeRange* range_ = nullptr;
+    _xmlNode* node_ = nullptr;
+  };
+  using const_iterator = iterator;
+
+  using NodeRangeBase::NodeRangeBase;
+
+  iterator begin() const noexcept { return iterator(this, first()); }
+  iterator end() const noexcept { return iterator(this, nullptr); }
+
+  /// Whether the range has no nodes.
+  bool empty() const noexcept { return !first(); }
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_NODES_NODERANGE_H
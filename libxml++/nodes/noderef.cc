@@ -0,0 +1,264 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/nodes/noderef.h>
+#include <libxml++/nodes/element.h>
+
+#include <libxml/tree.h>
+
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<xmlpp::NodeRef> &&
+  std::is_trivially_copyable_v<xmlpp::ElementRef>, "A node reference must be trivially copyable.");
+
+namespace
+{
+std::string_view to_view(const xmlChar* str) noexcept
+{
+  return str ? std::string_view(reinterpret_cast<const char*>(str)) : std::string_view();
+}
+
+bool has_name(const xmlNode* node, std::string_view name) noexcept
+{
+  return name.empty() || (node->name && name == reinterpret_cast<const char*>(node->name));
+}
+
+bool has_content(const xmlNode* node) noexcept
+{
+  switch (node->type)
+  {
+  case XML_TEXT_NODE:
+  case XML_CDATA_SECTION_NODE:
+  case XML_COMMENT_NODE:
+  case XML_PI_NODE:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Compare Node::get_namespace_uri2().
+// These node types are represented by structs with other fields than xmlNode.
+bool has_ns(const xmlNode* node) noexcept
+{
+  return !(node->type == XML_DOCUMENT_NODE ||
+    node->type == XML_HTML_DOCUMENT_NODE ||
+    node->type == XML_ENTITY_DECL ||
+    node->type == XML_ATTRIBUTE_DECL);
+}
+
+xmlNode* next_element(xmlNode* node, std::string_view name) noexcept
+{
+  for (; node; node = node->next)
+    if (node->type == XML_ELEMENT_NODE && has_name(node, name))
+      return node;
+  return nullptr;
+}
+} // anonymous namespace
+
+namespace xmlpp
+{
+
+NodeRef::NodeRef(const Node* node) noexcept
+: node_(node ? const_cast<xmlNode*>(node->cobj()) : nullptr)
+{
+}
+
+bool NodeRef::is_element() const noexcept
+{
+  return node_->type == XML_ELEMENT_NODE;
+}
+
+bool NodeRef::is_text() const noexcept
+{
+  return node_->type == XML_TEXT_NODE;
+}
+
+ElementRef NodeRef::as_element() const noexcept
+{
+  return ElementRef(node_ && node_->type == XML_ELEMENT_NODE ? node_ : nullptr);
+}
+
+std::optional<ustring> NodeRef::get_name2() const
+{
+  if (!node_->name)
+    return {};
+  return (const char*)node_->name;
+}
+
+std::string_view NodeRef::get_name_view() const noexcept
+{
+  return to_view(node_->name);
+}
+
+std::optional<ustring> NodeRef::get_namespace_prefix2() const
+{
+  if (node_->type == XML_ATTRIBUTE_DECL)
+  {
+    auto attr = reinterpret_cast<const xmlAttribute*>(node_);
+    if (!attr->prefix)
+      return {};
+    return (const char*)attr->prefix;
+  }
+
+  if (!(has_ns(node_) && node_->ns && node_->ns->prefix))
+    return {};
+  return (const char*)node_->ns->prefix;
+}
+
+std::optional<ustring> NodeRef::get_namespace_uri2() const
+{
+  if (!(has_ns(node_) && node_->ns && node_->ns->href))
+    return {};
+  return (const char*)node_->ns->href;
+}
+
+int NodeRef::get_line() const noexcept
+{
+  return XML_GET_LINE(node_);
+}
+
+std::optional<ustring> NodeRef::get_path2() const
+{
+  xmlChar* path = xmlGetNodePath(node_);
+  if (!path)
+    return {};
+  std::optional<ustring> result = (char*)path;
+  xmlFree(path);
+  return result;
+}
+
+std::optional<ustring> NodeRef::get_content2() const
+{
+  if (!(has_content(node_) && node_->content))
+    return {};
+  return (const char*)node_->content;
+}
+
+std::string_view NodeRef::get_content_view() const noexcept
+{
+  if (!has_content(node_))
+    return {};
+  return to_view(node_->content);
+}
+
+ElementRef NodeRef::get_parent() const noexcept
+{
+  if (!(node_->parent && node_->parent->type == XML_ELEMENT_NODE))
+    return ElementRef();
+  return ElementRef(node_->parent);
+}
+
+NodeRef NodeRef::get_next_sibling() const noexcept
+{
+  return NodeRef(node_->next);
+}
+
+NodeRef NodeRef::get_previous_sibling() const noexcept
+{
+  return NodeRef(node_->prev);
+}
+
+NodeRef NodeRef::get_first_child(std::string_view name) const noexcept
+{
+  for (auto child = node_->children; child; child = child->next)
+    if (has_name(child, name))
+      return NodeRef(child);
+  return NodeRef();
+}
+
+NodeRange<NodeRef> NodeRef::children() const
+{
+  return NodeRange<NodeRef>(node_, NodeRangeBase::Axis::CHILDREN);
+}
+
+NodeRange<NodeRef> NodeRef::descendants() const
+{
+  return NodeRange<NodeRef>(node_, NodeRangeBase::Axis::DESCENDANTS);
+}
+
+const Node* NodeRef::get_node() const
+{
+  if (!node_)
+    return nullptr;
+  Node::create_wrapper(node_);
+  return static_cast<const Node*>(node_->_private);
+}
+
+ElementRef::ElementRef(const Element* element) noexcept
+: NodeRef(element)
+{
+}
+
+std::optional<ustring> ElementRef::get_attribute_value2(const ustring& name,
+  const ustring& ns_prefix) const
+{
+  // Compare Element::get_attribute() and AttributeNode::get_value2().
+  // xmlGetNsProp() and xmlGetNoNsProp() also find default values in the DTD.
+  xmlChar* value = nullptr;
+  if (ns_prefix.empty())
+    value = xmlGetNoNsProp(node_, (const xmlChar*)name.c_str());
+  else
+  {
+    auto ns = xmlSearchNs(node_->doc, node_, (const xmlChar*)ns_prefix.c_str());
+    if (!(ns && ns->href))
+      return {}; // No such prefix.
+    value = xmlGetNsProp(node_, (const xmlChar*)name.c_str(), ns->href);
+  }
+
+  if (!value)
+    return {};
+  std::optional<ustring> result = (const char*)value;
+  xmlFree(value);
+  return result;
+}
+
+NodeRef ElementRef::get_first_child_text() const noexcept
+{
+  for (auto child = node_->children; child; child = child->next)
+    if (child->type == XML_TEXT_NODE)
+      return NodeRef(child);
+  return NodeRef();
+}
+
+bool ElementRef::has_child_text() const noexcept
+{
+  return static_cast<bool>(get_first_child_text());
+}
+
+ElementRef ElementRef::get_first_child_element(std::string_view name) const noexcept
+{
+  return ElementRef(next_element(node_->children, name));
+}
+
+ElementRef ElementRef::get_next_sibling_element(std::string_view name) const noexcept
+{
+  return ElementRef(next_element(node_->next, name));
+}
+
+NodeRange<ElementRef> ElementRef::child_elements(std::string_view name) const
+{
+  return NodeRange<ElementRef>(node_, NodeRangeBase::Axis::CHILDREN, true, name);
+}
+
+const Element* ElementRef::get_element() const
+{
+  return static_cast<const Element*>(get_node());
+}
+
+} // namespace xmlpp
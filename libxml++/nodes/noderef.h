@@ -0,0 +1,285 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_NODES_NODEREF_H
+#define __LIBXMLPP_NODES_NODEREF_H
+
+#include <libxml++config.h>
+#include <libxml++/ustring.h>
+#include <libxml++/nodes/noderange.h>
+
+#include <optional>
+#include <string_view>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlNode;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp
+{
+class Node;
+class Element;
+class ElementRef;
+
+/** A non-owning reference to a node, for reading and navigating a document.
+ *
+ * A NodeRef is a pointer to a libxml2 node, with a subset of the read and
+ * navigation methods of Node. Unlike Node's methods, NodeRef's methods
+ * don't create C++ wrappers of the nodes that they visit:
+ * @code
+ * for (auto child = root.get_first_child(); child; child = child.get_next_sibling())
+ *   if (auto element = child.as_element())
+ *     std::cout << element.get_name_view() << std::endl;
+ * @endcode
+ *
+ * A NodeRef is trivially copyable, and should be passed by value. It's valid
+ * as long as the node that it refers to exists.
+ * A default-constructed NodeRef refers to no node, and converts to false.
+ * It must not be used for anything but comparisons and conversion to bool.
+ *
+ * @newin{5,8}
+ */
+class NodeRef
+{
+public:
+  /** Create a reference to no node.
+   */
+  NodeRef() noexcept = default;
+
+  /** Create a reference to a libxml2 node.
+   * @param node An xmlNode, or <tt>nullptr</tt>.
+   */
+  explicit NodeRef(const _xmlNode* node) noexcept
+  : node_(const_cast<_xmlNode*>(node))
+  {}
+
+  /** Create a reference to the node of a C++ wrapper.
+   * @param node A node, or <tt>nullptr</tt>.
+   */
+  LIBXMLPP_API
+  explicit NodeRef(const Node* node) noexcept;
+
+  /** Whether this refers to a node.
+   */
+  explicit operator bool() const noexcept { return node_ != nullptr; }
+
+  bool operator==(NodeRef other) const noexcept { return node_ == other.node_; }
+  bool operator!=(NodeRef other) const noexcept { return node_ != other.node_; }
+
+  /** Whether this is an element node.
+   */
+  LIBXMLPP_API
+  bool is_element() const noexcept;
+
+  /** Whether this is a text node.
+   */
+  LIBXMLPP_API
+  bool is_text() const noexcept;
+
+  /** Get a reference to this node as an element.
+   * @returns A reference to the element, or to no node if this is not an element node.
+   */
+  LIBXMLPP_API
+  ElementRef as_element() const noexcept;
+
+  /** Get the name of this node.
+   * @returns The node's name, if any, else no value.
+   */
+  LIBXMLPP_API
+  std::optional<ustring> get_name2() const;
+
+  /** Get the name of this node, without copying it.
+   * @returns The node's name, or an empty view if the node has no name.
+   */
+  LIBXMLPP_API
+  std::string_view get_name_view() const noexcept;
+
+  /** Get the namespace prefix of this node.
+   * @returns The node's namespace prefix, or no value if the node has no
+   *          namespace prefix.
+   */
+  LIBXMLPP_API
+  std::optional<ustring> get_namespace_prefix2() const;
+
+  /** Get the namespace URI of this node.
+   * @returns The node's namespace URI, or no value if the node has no namespace URI.
+   */
+  LIBXMLPP_API
+  std::optional<ustring> get_namespace_uri2() const;
+
+  /** Discover at what line number this node occurs in the XML file.
+   * @returns The line number.
+   */
+  LIBXMLPP_API
+  int get_line() const noexcept;
+
+  /** Get the XPath of this node.
+   * @result The XPath of the node, or no value in case of error.
+   */
+  LIBXMLPP_API
+  std::optional<ustring> get_path2() const;
+
+  /** Get the content of a text, comment, CDATA or processing instruction node.
+   * @returns The node's content, or no value if the node has no content.
+   */
+  LIBXMLPP_API
+  std::optional<ustring> get_content2() const;
+
+  /** Get the content of a text, comment, CDATA or processing instruction node,
+   * without copying it.
+   * @returns The node's content, or an empty view if the node has no content.
+   */
+  LIBXMLPP_API
+  std::string_view get_content_view() const noexcept;
+
+  /** Get the parent element of this node.
+   * @returns The parent element, or a reference to no node if this node has
+   *          no parent element.
+   */
+  LIBXMLPP_API
+  ElementRef get_parent() const noexcept;
+
+  /** Get the next sibling of this node.
+   * @returns The next sibling, or a reference to no node if there is none.
+   */
+  LIBXMLPP_API
+  NodeRef get_next_sibling() const noexcept;
+
+  /** Get the previous sibling of this node.
+   * @returns The previous sibling, or a reference to no node if there is none.
+   */
+  LIBXMLPP_API
+  NodeRef get_previous_sibling() const noexcept;
+
+  /** Get the first child of this node.
+   * @param name The name of the requested child node, or an empty string.
+   * @returns The first child with the specified name, or a reference to no
+   *          node if there is none.
+   */
+  LIBXMLPP_API
+  NodeRef get_first_child(std::string_view name = std::string_view()) const noexcept;
+
+  /** Get a lazy range of the child nodes.
+   * @returns A range of the child nodes.
+   */
+  LIBXMLPP_API
+  NodeRange<NodeRef> children() const;
+
+  /** Get a lazy range of the descendant nodes, in document order.
+   * See Node::descendants().
+   * @returns A range of the descendant nodes.
+   */
+  LIBXMLPP_API
+  NodeRange<NodeRef> descendants() const;
+
+  /** Get the C++ wrapper of this node.
+   * This creates the wrapper, if the node has none.
+   * @returns The node's C++ wrapper, or <tt>nullptr</tt> if this refers to no node.
+   */
+  LIBXMLPP_API
+  const Node* get_node() const;
+
+  ///Access the underlying libxml implementation.
+  const _xmlNode* cobj() const noexcept { return node_; }
+
+protected:
+  _xmlNode* node_ = nullptr;
+};
+
+/** A non-owning reference to an element node.
+ *
+ * See NodeRef.
+ *
+ * @newin{5,8}
+ */
+class ElementRef : public NodeRef
+{
+public:
+  /** Create a reference to no node.
+   */
+  ElementRef() noexcept = default;
+
+  /** Create a reference to a libxml2 element node.
+   * @param node An xmlNode of type XML_ELEMENT_NODE, or <tt>nullptr</tt>.
+   */
+  explicit ElementRef(const _xmlNode* node) noexcept
+  : NodeRef(node)
+  {}
+
+  /** Create a reference to the node of an Element.
+   * @param element An element, or <tt>nullptr</tt>.
+   */
+  LIBXMLPP_API
+  explicit ElementRef(const Element* element) noexcept;
+
+  /** Get the value of this element's attribute.
+   * @param name The name of the attribute whose value will be retrieved.
+   * @param ns_prefix Namespace prefix.
+   * @return The value of the attribute, or no value if no suitable Attribute was found.
+   */
+  LIBXMLPP_API
+  std::optional<ustring> get_attribute_value2(const ustring& name,
+    const ustring& ns_prefix = ustring()) const;
+
+  /** Get the first child text node of this element.
+   * @returns The first text node child, or a reference to no node if there is none.
+   */
+  LIBXMLPP_API
+  NodeRef get_first_child_text() const noexcept;
+
+  /** Whether this element has a child text node.
+   */
+  LIBXMLPP_API
+  bool has_child_text() const noexcept;
+
+  /** Get the first child element of this element.
+   * @param name The name of the requested child element, or an empty string.
+   * @returns The first child element with the specified name, or a reference
+   *          to no node if there is none.
+   */
+  LIBXMLPP_API
+  ElementRef get_first_child_element(std::string_view name = std::string_view()) const noexcept;
+
+  /** Get the next sibling element of this element.
+   * @param name The name of the requested sibling element, or an empty string.
+   * @returns The next sibling element with the specified name, or a reference
+   *          to no node if there is none.
+   */
+  LIBXMLPP_API
+  ElementRef get_next_sibling_element(std::string_view name = std::string_view()) const noexcept;
+
+  /** Get a lazy range of the child elements.
+   * @param name The name of the child elements, or an empty string for all child elements.
+   * @returns A range of the child elements.
+   */
+  LIBXMLPP_API
+  NodeRange<ElementRef> child_elements(std::string_view name = std::string_view()) const;
+
+  /** Get the C++ wrapper of this element.
+   * This creates the wrapper, if the element has none.
+   * @returns The element's C++ wrapper, or <tt>nullptr</tt> if this refers to no node.
+   */
+  LIBXMLPP_API
+  const Element* get_element() const;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_NODES_NODEREF_H
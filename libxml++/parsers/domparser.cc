@@ -9,8 +9,9 @@
 #include "libxml++/nodes/element.h"
 #include "libxml++/nodes/textnode.h"
 #include "libxml++/nodes/commentnode.h"
-#include "libxml++/keepblanks.h"
 #include "libxml++/exceptions/internal_error.h"
+#include "libxml++/io/istreamreader.h"
+#include "libxml++/io/mappedfile.h"
 #include <libxml/parserInternals.h>//For xmlCreateFileParserCtxt().
 #include <libxml/xinclude.h>
 
@@ -23,9 +24,7 @@ namespace {
                                  char * buffer,
                                  int len)
     {
-      auto in = static_cast<std::istream*>(context);
-      in->read(buffer, len);
-      return in->gcount();
+      return static_cast<xmlpp::IStreamReader*>(context)->read(buffer, len);
     }
   }
 }
@@ -76,11 +75,10 @@ void DomParser::parse_file(const std::string& filename)
 {
   release_underlying(); //Free any existing document.
 
-  KeepBlanks k(KeepBlanks::Default);
   xmlResetLastError();
 
   //The following is based on the implementation of xmlParseFile(), in xmlSAXParseFileWithData():
-  context_ = xmlCreateFileParserCtxt(filename.c_str());
+  context_ = create_file_context(filename);
 
   if(!context_)
   {
@@ -95,15 +93,31 @@ void DomParser::parse_file(const std::string& filename)
   parse_context();
 }
 
+void DomParser::parse_mapped_file(const std::string& filename)
+{
+  release_underlying(); //Free any existing document.
+
+  xmlResetLastError();
+
+  MappedFile file(filename);
+  context_ = create_mapped_file_context(file);
+
+  if(!context_)
+  {
+    throw internal_error("Could not create parser context\n" + format_xml_error());
+  }
+
+  parse_context();
+}
+
 void DomParser::parse_memory_raw(const unsigned char* contents, size_type bytes_count)
 {
   release_underlying(); //Free any existing document.
 
-  KeepBlanks k(KeepBlanks::Default);
   xmlResetLastError();
 
   //The following is based on the implementation of xmlParseFile(), in xmlSAXParseFileWithData():
-  context_ = xmlCreateMemoryParserCtxt((const char*)contents, bytes_count);
+  context_ = create_memory_context(contents, bytes_count);
 
   if(!context_)
   {
@@ -120,7 +134,6 @@ void DomParser::parse_memory(const ustring& contents)
 
 void DomParser::parse_context()
 {
-  KeepBlanks k(KeepBlanks::Default);
   xmlResetLastError();
 
   //The following is based on the implementation of xmlParseFile(), in xmlSAXParseFileWithData():
@@ -173,11 +186,14 @@ void DomParser::check_xinclude_and_finish_parsing()
     const int n_substitutions = xmlXIncludeProcessFlags(context_->myDoc, options);
     if (n_substitutions < 0)
     {
-      throw parse_error("Couldn't process XInclude\n" + format_xml_error());
+      auto error_str = format_xml_error();
+      // Free the context, so a chunk-wise parse does not continue in it.
+      release_underlying();
+      throw parse_error("Couldn't process XInclude\n" + error_str);
     }
   }
 
-  doc_ = new Document(context_->myDoc);
+  doc_ = new Document(context_->myDoc, Document::NewDocument());
   // This is to indicate to release_underlying() that we took the
   // ownership on the doc.
   context_->myDoc = nullptr;
@@ -191,15 +207,15 @@ void DomParser::parse_stream(std::istream& in)
 {
   release_underlying(); //Free any existing document.
 
-  KeepBlanks k(KeepBlanks::Default);
   xmlResetLastError();
+  IStreamReader reader(in, get_stream_block_size(), get_stream_read_ahead());
 
   context_ = xmlCreateIOParserCtxt(
       nullptr, // Setting those two parameters to nullptr force the parser
       nullptr, // to create a document while parsing.
       _io_read_callback,
       nullptr, // inputCloseCallback
-      &in,
+      &reader,
       XML_CHAR_ENCODING_NONE);
 
   if(!context_)
@@ -210,6 +226,85 @@ void DomParser::parse_stream(std::istream& in)
   parse_context();
 }
 
+void DomParser::parse_chunk(const ustring& chunk)
+{
+  parse_chunk_raw((const unsigned char*)chunk.c_str(), chunk.size());
+}
+
+void DomParser::parse_chunk_raw(const unsigned char* contents, size_type bytes_count)
+{
+  initialize_chunk_parsing();
+  const int parseError = xmlParseChunk(context_, (const char*)contents, bytes_count,
+    0 /* don't terminate */);
+  check_chunk_result(parseError);
+}
+
+void DomParser::finish_chunk_parsing()
+{
+  initialize_chunk_parsing();
+  //This is called just to terminate parsing.
+  const int parseError = xmlParseChunk(context_, nullptr /* chunk */, 0 /* size */,
+    1 /* terminate (1 or 0) */);
+  check_chunk_result(parseError);
+
+  if (!context_->myDoc)
+  {
+    release_underlying(); //Free context_
+    throw parse_error("No document was parsed.");
+  }
+
+  check_xinclude_and_finish_parsing();
+}
+
+void DomParser::initialize_chunk_parsing()
+{
+  xmlResetLastError();
+
+  if (context_)
+  {
+    xmlCtxtResetLastError(context_);
+    return;
+  }
+
+  release_underlying(); //Free any existing document.
+
+  context_ = xmlCreatePushParserCtxt(
+    nullptr,  // Setting those two parameters to nullptr force the parser
+    nullptr,  // to create a document while parsing.
+    nullptr,  // chunk
+    0,        // size
+    nullptr); // no filename for fetching external entities
+
+  if(!context_)
+  {
+    throw internal_error("Could not create parser context\n" + format_xml_error());
+  }
+  initialize_context();
+}
+
+void DomParser::check_chunk_result(int parse_error_code)
+{
+  try
+  {
+    check_for_exception();
+  }
+  catch (...)
+  {
+    release_underlying(); //Free doc_ and context_
+    throw; // re-throw exception
+  }
+
+  auto error_str = format_xml_parser_error(context_);
+  if (error_str.empty() && parse_error_code != XML_ERR_OK)
+    error_str = "Error code from xmlParseChunk(): " + std::to_string(parse_error_code);
+
+  if(!error_str.empty())
+  {
+    release_underlying(); //Free doc_ and context_
+    throw parse_error(error_str);
+  }
+}
+
 void DomParser::release_underlying()
 {
   if(doc_)
@@ -72,6 +72,26 @@ public:
   LIBXMLPP_API
   void parse_file(const std::string& filename) override;
 
+  /** Parse an XML document from a memory-mapped file.
+   * If the parser already contains a document, that document and all its nodes
+   * are deleted.
+   *
+   * The file is parsed directly from the operating system's page cache,
+   * without read() calls. With libxml2 2.13 and later, files smaller than
+   * 2 GiB are parsed in place, without being copied into the parser's input
+   * buffer. Otherwise the parser copies blocks from the mapping as it needs
+   * them. See MappedFile.
+   *
+   * @newin{5,8}
+   *
+   * @param filename The path to the file.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::parse_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void parse_mapped_file(const std::string& filename);
+
   /** Parse an XML document from a string.
    * If the parser already contains a document, that document and all its nodes
    * are deleted.
@@ -106,6 +126,56 @@ public:
   LIBXMLPP_API
   void parse_stream(std::istream& in) override;
 
+  /** Parse a chunk of data.
+   *
+   * This lets you pass a document in small chunks, e.g. from a network
+   * connection. The document is built while the chunks arrive, so the whole
+   * document never has to be stored as text.
+   *
+   * The first call to parse_chunk() deletes the document that the parser
+   * contains, if any, and sets up the parser. When the last chunk has been
+   * parsed, call finish_chunk_parsing() to finish the parse. get_document()
+   * returns <tt>nullptr</tt> until then.
+   *
+   * @newin{5,8}
+   *
+   * @param chunk The next piece of the XML document.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::parse_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void parse_chunk(const ustring& chunk);
+
+  /** Parse a chunk of data.
+   *
+   * See parse_chunk().
+   *
+   * @newin{5,8}
+   *
+   * @param contents The next piece of the XML document as an array of bytes.
+   * @param bytes_count The number of bytes in the @a contents array.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::parse_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void parse_chunk_raw(const unsigned char* contents, size_type bytes_count);
+
+  /** Finish a chunk-wise parse.
+   *
+   * Call this after the last call to parse_chunk() or parse_chunk_raw().
+   * Don't use this function with the other parsing methods.
+   *
+   * @newin{5,8}
+   *
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::parse_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void finish_chunk_parsing();
+
   /** Test whether a document has been parsed.
    */
   LIBXMLPP_API
@@ -134,6 +204,12 @@ protected:
 
   int xinclude_options_ = 0;
   Document* doc_;
+
+private:
+  // Create the context of a chunk-wise parse, if it has not been created.
+  void initialize_chunk_parsing();
+  // Throw an exception, if the last call to xmlParseChunk() has failed.
+  void check_chunk_result(int parse_error_code);
 };
 
 } // namespace xmlpp
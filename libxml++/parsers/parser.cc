@@ -11,9 +11,15 @@
 #define XML_DEPRECATED_MEMBER
 
 #include "libxml++/exceptions/wrapped_exception.h"
+#include "libxml++/io/istreamreader.h"
+#include "libxml++/io/mappedfile.h"
 #include "libxml++/parsers/parser.h"
 
 #include <libxml/parser.h>
+#include <libxml/parserInternals.h> // inputPush(), xmlParserGetDirectory()
+#include <libxml/SAX2.h> // xmlSAX2IgnorableWhitespace()
+
+#include <climits> // INT_MAX
 
 namespace
 {
@@ -54,6 +60,11 @@ static void c_callback_validity_warning(void* ctx, const char* msg, ...)
   p_callback_error_or_warning(false, false, ctx, msg, var_args);
   va_end(var_args);
 }
+
+static int c_mapped_file_read_callback(void* context, char* buffer, int len)
+{
+  return static_cast<xmlpp::MappedFile*>(context)->read(buffer, len);
+}
 } // extern "C"
 } // anonymous namespace
 
@@ -65,9 +76,38 @@ struct Parser::Impl
   Impl()
   :
   throw_messages_(true), validate_(false), substitute_entities_(false),
-  include_default_attributes_(false), set_options_(0), clear_options_(0)
+  include_default_attributes_(false), set_options_(0), clear_options_(0),
+  stream_block_size_(IStreamReader::default_block_size), stream_read_ahead_(false),
+  reuse_context_(false), reusable_context_(nullptr), spare_context_(nullptr)
   {}
 
+  ~Impl()
+  {
+    free_spare_context();
+  }
+
+  void free_spare_context() noexcept
+  {
+    if (spare_context_)
+    {
+      xmlFreeParserCtxt(spare_context_);
+      spare_context_ = nullptr;
+    }
+  }
+
+  // Reset the kept context, if any, for the next parse.
+  xmlParserCtxtPtr take_spare_context() noexcept
+  {
+    auto context = spare_context_;
+    spare_context_ = nullptr;
+    if (context)
+    {
+      xmlCtxtReset(context);
+      xmlCtxtResetLastError(context);
+    }
+    return context;
+  }
+
   // Built gradually - used in an exception at the end of parsing.
   ustring parser_error_;
   ustring parser_warning_;
@@ -80,6 +120,15 @@ struct Parser::Impl
   bool include_default_attributes_;
   int set_options_;
   int clear_options_;
+  std::size_t stream_block_size_;
+  bool stream_read_ahead_;
+
+  bool reuse_context_;
+  // The context that create_file_context() or create_memory_context()
+  // returned for the current parse, which can be kept for the next one.
+  xmlParserCtxtPtr reusable_context_;
+  // The context that was kept after the previous parse.
+  xmlParserCtxtPtr spare_context_;
 };
 
 Parser::Parser()
@@ -95,6 +144,7 @@ Parser::~Parser()
 void Parser::set_validate(bool val) noexcept
 {
   pimpl_->validate_ = val;
+  pimpl_->free_spare_context();
 }
 
 bool Parser::get_validate() const noexcept
@@ -105,6 +155,7 @@ bool Parser::get_validate() const noexcept
 void Parser::set_substitute_entities(bool val) noexcept
 {
   pimpl_->substitute_entities_ = val;
+  pimpl_->free_spare_context();
 }
 
 bool Parser::get_substitute_entities() const noexcept
@@ -115,6 +166,7 @@ bool Parser::get_substitute_entities() const noexcept
 void Parser::set_throw_messages(bool val) noexcept
 {
   pimpl_->throw_messages_ = val;
+  pimpl_->free_spare_context();
 }
 
 bool Parser::get_throw_messages() const noexcept
@@ -125,6 +177,7 @@ bool Parser::get_throw_messages() const noexcept
 void Parser::set_include_default_attributes(bool val) noexcept
 {
   pimpl_->include_default_attributes_ = val;
+  pimpl_->free_spare_context();
 }
 
 bool Parser::get_include_default_attributes() const noexcept
@@ -136,6 +189,7 @@ void Parser::set_parser_options(int set_options, int clear_options) noexcept
 {
   pimpl_->set_options_ = set_options;
   pimpl_->clear_options_ = clear_options;
+  pimpl_->free_spare_context();
 }
 
 void Parser::get_parser_options(int& set_options, int& clear_options) const noexcept
@@ -144,6 +198,38 @@ void Parser::get_parser_options(int& set_options, int& clear_options) const noex
   clear_options = pimpl_->clear_options_;
 }
 
+void Parser::set_stream_block_size(std::size_t block_size) noexcept
+{
+  pimpl_->stream_block_size_ = block_size ? block_size : IStreamReader::default_block_size;
+}
+
+std::size_t Parser::get_stream_block_size() const noexcept
+{
+  return pimpl_->stream_block_size_;
+}
+
+void Parser::set_stream_read_ahead(bool val) noexcept
+{
+  pimpl_->stream_read_ahead_ = val;
+}
+
+bool Parser::get_stream_read_ahead() const noexcept
+{
+  return pimpl_->stream_read_ahead_;
+}
+
+void Parser::set_reuse_context(bool val) noexcept
+{
+  pimpl_->reuse_context_ = val;
+  if (!val)
+    pimpl_->free_spare_context();
+}
+
+bool Parser::get_reuse_context() const noexcept
+{
+  return pimpl_->reuse_context_;
+}
+
 void Parser::initialize_context()
 {
   //Clear these temporary buffers:
@@ -175,12 +261,25 @@ void Parser::initialize_context()
   else
     options &= ~XML_PARSE_DTDATTR;
 
+  // A new context copies the global xmlKeepBlanksDefault() setting.
+  // Keep blanks unless this parser's options say otherwise, whatever
+  // the global setting is, so it need not be changed during parsing.
+  options &= ~XML_PARSE_NOBLANKS;
+
   //Turn on/off any parser options.
   options |= pimpl_->set_options_;
   options &= ~pimpl_->clear_options_;
 
   xmlCtxtUseOptions(context_, options);
 
+  // xmlCtxtUseOptions() doesn't undo the global setting's effects.
+  if (!(options & XML_PARSE_NOBLANKS))
+  {
+    context_->keepBlanks = 1;
+    if (context_->sax && context_->sax->ignorableWhitespace == xmlSAX2IgnorableWhitespace)
+      context_->sax->ignorableWhitespace = context_->sax->characters;
+  }
+
   if (context_->sax && pimpl_->throw_messages_)
   {
     //Tell the parser context about the callbacks.
@@ -210,9 +309,15 @@ void Parser::release_underlying()
     if( context_->myDoc != nullptr )
     {
       xmlFreeDoc(context_->myDoc);
+      context_->myDoc = nullptr;
     }
 
-    xmlFreeParserCtxt(context_);
+    if (context_ == pimpl_->reusable_context_ && pimpl_->reuse_context_ &&
+        !pimpl_->spare_context_)
+      pimpl_->spare_context_ = context_; // Keep it for the next parse.
+    else
+      xmlFreeParserCtxt(context_);
+    pimpl_->reusable_context_ = nullptr;
     context_ = nullptr;
   }
 }
@@ -404,6 +509,102 @@ void Parser::callback_error_or_warning(bool is_parser, bool is_error, void* ctx,
   }
 }
 
+//static
+_xmlParserCtxt* Parser::create_mapped_file_context(MappedFile& file)
+{
+  xmlParserCtxtPtr context = nullptr;
+
+#if LIBXML_VERSION >= 21300
+  // Memory input is parsed in place, without copying.
+  // libxml2 can't parse more than INT_MAX bytes from memory in one piece.
+  // An empty file is also read via the callback, to get the same error
+  // as from parse_file().
+  if (file.size() > 0 && file.size() <= INT_MAX)
+    context = xmlCreateMemoryParserCtxt((const char*)file.data(), static_cast<int>(file.size()));
+  else
+#endif
+  {
+    // Older libxml2 versions copy all of a memory input into a buffer before
+    // parsing it. Reading blocks directly from the mapping avoids that copy,
+    // and the read() calls of parse_file().
+    context = xmlCreateIOParserCtxt(
+      nullptr, // sax
+      nullptr, // user_data
+      c_mapped_file_read_callback,
+      nullptr, // inputCloseCallback
+      &file,
+      XML_CHAR_ENCODING_NONE);
+  }
+
+  if (!context)
+    return nullptr;
+
+  // As xmlReadMemory() does, tell the parser where the document comes from.
+  // It's used in error messages and as the document's URL.
+  const auto& filename = file.get_filename();
+  if (context->input && context->input->filename == nullptr)
+    context->input->filename = (char*)xmlStrdup((const xmlChar*)filename.c_str());
+
+  if (context->directory == nullptr)
+    context->directory = xmlParserGetDirectory(filename.c_str());
+
+  return context;
+}
+
+_xmlParserCtxt* Parser::create_file_context(const std::string& filename)
+{
+  auto context = pimpl_->reuse_context_ ? pimpl_->take_spare_context() : nullptr;
+  if (!context)
+    context = xmlCreateFileParserCtxt(filename.c_str());
+  else
+  {
+    // As xmlCtxtReadFile() does.
+    auto input = xmlLoadExternalEntity(filename.c_str(), nullptr, context);
+    if (!input)
+    {
+      pimpl_->spare_context_ = context;
+      return nullptr;
+    }
+    inputPush(context, input);
+    if (context->directory == nullptr)
+      context->directory = xmlParserGetDirectory(filename.c_str());
+  }
+
+  if (context && pimpl_->reuse_context_)
+    pimpl_->reusable_context_ = context;
+  return context;
+}
+
+_xmlParserCtxt* Parser::create_memory_context(const unsigned char* contents, size_type bytes_count)
+{
+  // xmlCreateMemoryParserCtxt() accepts at most INT_MAX bytes, and not 0 bytes.
+  if (!contents || bytes_count == 0 || bytes_count > INT_MAX)
+    return nullptr;
+
+  auto context = pimpl_->reuse_context_ ? pimpl_->take_spare_context() : nullptr;
+  if (!context)
+    context = xmlCreateMemoryParserCtxt((const char*)contents, static_cast<int>(bytes_count));
+  else
+  {
+    // As xmlCtxtReadMemory() does.
+    auto buffer = xmlParserInputBufferCreateMem((const char*)contents,
+      static_cast<int>(bytes_count), XML_CHAR_ENCODING_NONE);
+    auto input = buffer ? xmlNewIOInputStream(context, buffer, XML_CHAR_ENCODING_NONE) : nullptr;
+    if (!input)
+    {
+      if (buffer)
+        xmlFreeParserInputBuffer(buffer);
+      pimpl_->spare_context_ = context;
+      return nullptr;
+    }
+    inputPush(context, input);
+  }
+
+  if (context && pimpl_->reuse_context_)
+    pimpl_->reusable_context_ = context;
+  return context;
+}
+
 void Parser::handle_exception()
 {
   try
@@ -24,6 +24,8 @@ extern "C" {
 
 namespace xmlpp {
 
+class MappedFile;
+
 extern "C" {
   /** Type of function pointer to callback function with C linkage.
    * @newin{5,2}
@@ -153,6 +155,80 @@ public:
   LIBXMLPP_API
   void get_parser_options(int& set_options, int& clear_options) const noexcept;
 
+  /** Set how many bytes parse_stream() reads from the stream at a time.
+   *
+   * The stream is read in blocks with std::streambuf::sgetn(), instead of
+   * in the small pieces that libxml2 asks for. See IStreamReader.
+   * The default is IStreamReader::default_block_size.
+   *
+   * @newin{5,8}
+   *
+   * @param block_size The block size in bytes. 0 means the default.
+   */
+  LIBXMLPP_API
+  void set_stream_block_size(std::size_t block_size) noexcept;
+
+  /** See set_stream_block_size().
+   *
+   * @newin{5,8}
+   *
+   * @returns The block size in bytes.
+   */
+  LIBXMLPP_API
+  std::size_t get_stream_block_size() const noexcept;
+
+  /** Set whether parse_stream() reads blocks ahead on a background thread.
+   *
+   * Reading ahead lets a slow stream, such as a socket, be read while the
+   * parser works on the previous block. The stream's buffer must not be used
+   * by other threads during the parse. By default, there is no read-ahead.
+   *
+   * @newin{5,8}
+   *
+   * @param val Whether blocks are read ahead.
+   */
+  LIBXMLPP_API
+  void set_stream_read_ahead(bool val = true) noexcept;
+
+  /** See set_stream_read_ahead().
+   *
+   * @newin{5,8}
+   *
+   * @returns Whether blocks are read ahead.
+   */
+  LIBXMLPP_API
+  bool get_stream_read_ahead() const noexcept;
+
+  /** Set whether the parser context is kept and reused by the next parse.
+   *
+   * Normally each parse creates a new libxml2 parser context and frees it
+   * when the parse is finished. A parser that parses many documents can
+   * instead keep its context, and reset it with xmlCtxtReset() before the
+   * next parse_file(), parse_memory() or parse_memory_raw(). That saves the
+   * allocation and initialization of the context and its buffers.
+   *
+   * The context's dictionary of names is kept too. It grows with the number of
+   * different names in the parsed documents.
+   * A kept context is freed when the parser's options are changed.
+   *
+   * By default, the context is not reused.
+   *
+   * @newin{5,8}
+   *
+   * @param val Whether the context is reused.
+   */
+  LIBXMLPP_API
+  void set_reuse_context(bool val = true) noexcept;
+
+  /** See set_reuse_context().
+   *
+   * @newin{5,8}
+   *
+   * @returns Whether the context is reused.
+   */
+  LIBXMLPP_API
+  bool get_reuse_context() const noexcept;
+
   /** Parse an XML document from a file.
    * @throw exception
    * @param filename The path to the file.
@@ -255,6 +331,46 @@ protected:
   static void callback_error_or_warning(bool is_parser, bool is_error, void* ctx,
                                         const char* msg, va_list var_args);
 
+  /** Create a parser context that reads a memory-mapped file.
+   *
+   * The context reads directly from the mapping, which must outlive it.
+   * The file's name is used as the document's URL.
+   *
+   * @newin{5,8}
+   *
+   * @param file The mapped file.
+   * @returns The new context, or <tt>nullptr</tt> if it can't be created.
+   */
+  LIBXMLPP_API
+  static _xmlParserCtxt* create_mapped_file_context(MappedFile& file);
+
+  /** Create a parser context that reads a file.
+   *
+   * If set_reuse_context() is set, and the context of the previous parse has
+   * been kept, that context is reset and returned instead of a new one.
+   *
+   * @newin{5,8}
+   *
+   * @param filename The path to the file.
+   * @returns The context, or <tt>nullptr</tt> if it can't be created.
+   */
+  LIBXMLPP_API
+  _xmlParserCtxt* create_file_context(const std::string& filename);
+
+  /** Create a parser context that reads from memory.
+   *
+   * If set_reuse_context() is set, and the context of the previous parse has
+   * been kept, that context is reset and returned instead of a new one.
+   *
+   * @newin{5,8}
+   *
+   * @param contents The XML document as an array of bytes.
+   * @param bytes_count The number of bytes in the @a contents array.
+   * @returns The context, or <tt>nullptr</tt> if it can't be created.
+   */
+  LIBXMLPP_API
+  _xmlParserCtxt* create_memory_context(const unsigned char* contents, size_type bytes_count);
+
   _xmlParserCtxt* context_;
   std::unique_ptr<exception> exception_;
 
@@ -0,0 +1,142 @@
+/* parserpool.cc
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+#include "libxml++/parsers/parserpool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
+namespace xmlpp
+{
+
+struct ParserPoolBase::Impl
+{
+  explicit Impl(unsigned int n_threads)
+  : n_threads_(n_threads ? n_threads : std::thread::hardware_concurrency())
+  {
+    if (n_threads_ == 0)
+      n_threads_ = 1;
+  }
+
+  ~Impl()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    work_cond_.notify_all();
+    for (auto& worker : workers_)
+      worker.join();
+  }
+
+  void work(unsigned int slot) noexcept
+  {
+    for (std::size_t item; (item = next_item_.fetch_add(1)) < n_items_;)
+      (*work_)(slot, item);
+  }
+
+  // batches_done is the batch that was current when the worker was started.
+  // The worker waits for the next one.
+  void worker_thread(unsigned int slot, unsigned int batches_done) noexcept
+  {
+    for (;;)
+    {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_cond_.wait(lock, [&] { return stop_ || batch_ != batches_done; });
+        if (stop_)
+          return;
+        batches_done = batch_;
+      }
+
+      work(slot);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--n_busy_workers_ == 0)
+          done_cond_.notify_all();
+      }
+    }
+  }
+
+  unsigned int n_threads_;
+
+  // Serializes run_batch() calls.
+  std::mutex batch_mutex_;
+
+  // The current batch. Set while mutex_ is locked, and no worker is busy.
+  const BatchFunction* work_ = nullptr;
+  std::size_t n_items_ = 0;
+  std::atomic<std::size_t> next_item_{0};
+
+  // Protected by mutex_. batch_ is changed only while batch_mutex_ is
+  // locked, too, so run_batch() can read it without locking mutex_.
+  unsigned int batch_ = 0;
+  unsigned int n_busy_workers_ = 0;
+  bool stop_ = false;
+
+  std::mutex mutex_;
+  std::condition_variable work_cond_;
+  std::condition_variable done_cond_;
+  // Slots 0 to n_threads_ - 2. The thread that runs a batch uses the last slot.
+  std::vector<std::thread> workers_;
+};
+
+ParserPoolBase::ParserPoolBase(unsigned int n_threads)
+: pimpl_(new Impl(n_threads))
+{
+}
+
+ParserPoolBase::~ParserPoolBase()
+{
+}
+
+unsigned int ParserPoolBase::get_n_threads() const noexcept
+{
+  return pimpl_->n_threads_;
+}
+
+void ParserPoolBase::run_batch(std::size_t n_items, const BatchFunction& work)
+{
+  auto& impl = *pimpl_;
+  std::lock_guard<std::mutex> batch_lock(impl.batch_mutex_);
+
+  if (n_items == 0)
+    return;
+
+  // The workers are started by the first batch that can use them.
+  // Earlier batches must not be run by the new workers.
+  const auto n_workers = static_cast<std::size_t>(impl.n_threads_ - 1);
+  if (impl.workers_.size() < n_workers && n_items > 1)
+  {
+    impl.workers_.reserve(n_workers);
+    while (impl.workers_.size() < n_workers)
+    {
+      const auto slot = static_cast<unsigned int>(impl.workers_.size());
+      impl.workers_.emplace_back(&Impl::worker_thread, &impl, slot, impl.batch_);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(impl.mutex_);
+    impl.work_ = &work;
+    impl.n_items_ = n_items;
+    impl.next_item_ = 0;
+    impl.n_busy_workers_ = static_cast<unsigned int>(impl.workers_.size());
+    ++impl.batch_;
+  }
+  impl.work_cond_.notify_all();
+
+  impl.work(impl.n_threads_ - 1);
+
+  std::unique_lock<std::mutex> lock(impl.mutex_);
+  impl.done_cond_.wait(lock, [&] { return impl.n_busy_workers_ == 0; });
+  impl.work_ = nullptr;
+}
+
+} // namespace xmlpp
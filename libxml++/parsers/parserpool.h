@@ -0,0 +1,259 @@
+/* parserpool.h
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+#ifndef __LIBXMLPP_PARSERS_PARSERPOOL_H
+#define __LIBXMLPP_PARSERS_PARSERPOOL_H
+
+#include <libxml++/parsers/parser.h>
+#include <libxml++/exceptions/parse_error.h>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace xmlpp {
+
+/** Base class of ParserPool.
+ *
+ * Runs batches of work on a set of threads that are started when the
+ * first batch is run, and kept until the pool is destroyed.
+ *
+ * Use ParserPool or BatchValidator instead of deriving directly from this class.
+ *
+ * @newin{5,8}
+ */
+class ParserPoolBase : public NonCopyable
+{
+public:
+  /** The number of threads that a batch is spread over, including the
+   * thread that runs the batch.
+   */
+  LIBXMLPP_API
+  unsigned int get_n_threads() const noexcept;
+
+protected:
+  /**
+   * @param n_threads The number of threads, including the thread that runs
+   *        a batch. 0 means std::thread::hardware_concurrency().
+   */
+  LIBXMLPP_API
+  explicit ParserPoolBase(unsigned int n_threads);
+  LIBXMLPP_API
+  ~ParserPoolBase() override;
+
+  /** Called for each item of a batch.
+   * @param slot The slot of the thread, in the range [0, get_n_threads()).
+   *        A slot is used by only one thread at a time.
+   * @param item The item, in the range [0, n_items).
+   */
+  using BatchFunction = std::function<void(unsigned int slot, std::size_t item)>;
+
+  /** Process the items of a batch, spread over the pool's threads.
+   *
+   * Returns when all items have been processed. If several threads call
+   * run_batch(), the batches are run one after the other.
+   *
+   * @param n_items The number of items.
+   * @param work Called for each item. Must not throw.
+   * @throws std::system_error If a thread can't be started.
+   */
+  LIBXMLPP_API
+  void run_batch(std::size_t n_items, const BatchFunction& work);
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+/** A pool of reusable parsers, for parsing many documents.
+ *
+ * Each parser in the pool reuses its libxml2 parser context from one document
+ * to the next (see Parser::set_reuse_context()), instead of creating and
+ * freeing a context for each document.
+ *
+ * Threads that parse documents themselves borrow a parser with acquire(),
+ * and give it back when the returned Lease is destroyed:
+ * @code
+ * xmlpp::ParserPool<xmlpp::DomParser> pool;
+ * ...
+ * // In any thread:
+ * auto parser = pool.acquire();
+ * parser->parse_memory(contents);
+ * auto root = parser->get_document()->get_root_node();
+ * @endcode
+ *
+ * A batch of documents in memory is parsed with parse_all(), which spreads
+ * the documents over the pool's threads. Each thread has its own parser.
+ *
+ * The pool must outlive the leases that acquire() returns.
+ *
+ * @tparam ParserType DomParser, or a class derived from SaxParser or DomParser.
+ *
+ * @newin{5,8}
+ */
+template <typename ParserType>
+class ParserPool : public ParserPoolBase
+{
+public:
+  /// Creates and configures the parsers of the pool.
+  using Factory = std::function<std::unique_ptr<ParserType>()>;
+
+  /** A parser that is borrowed from the pool, and given back on destruction.
+   */
+  class Lease
+  {
+  public:
+    Lease(Lease&& other) noexcept
+    : pool_(other.pool_), parser_(std::move(other.parser_))
+    {}
+
+    Lease& operator=(Lease&& other) noexcept
+    {
+      give_back();
+      pool_ = other.pool_;
+      parser_ = std::move(other.parser_);
+      return *this;
+    }
+
+    ~Lease()
+    {
+      give_back();
+    }
+
+    ParserType& operator*() const noexcept { return *parser_; }
+    ParserType* operator->() const noexcept { return parser_.get(); }
+    ParserType* get() const noexcept { return parser_.get(); }
+
+  private:
+    friend class ParserPool;
+
+    Lease(ParserPool* pool, std::unique_ptr<ParserType> parser) noexcept
+    : pool_(pool), parser_(std::move(parser))
+    {}
+
+    void give_back() noexcept
+    {
+      if (parser_)
+        pool_->give_back(std::move(parser_));
+    }
+
+    ParserPool* pool_;
+    std::unique_ptr<ParserType> parser_;
+  };
+
+  /**
+   * @param n_threads The number of threads that parse_all() uses, including
+   *        the calling thread. 0 means std::thread::hardware_concurrency().
+   * @param factory Creates the parsers. By default, the parsers are
+   *        default-constructed.
+   */
+  explicit ParserPool(unsigned int n_threads = 0, Factory factory = Factory())
+  : ParserPoolBase(n_threads), factory_(std::move(factory)), slot_parsers_(get_n_threads())
+  {}
+
+  /** Borrow a parser.
+   * A parser that a previous Lease has given back is returned, if there is one.
+   * Otherwise a new parser is created.
+   * @returns The parser.
+   */
+  Lease acquire()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_parsers_.empty())
+      {
+        auto parser = std::move(free_parsers_.back());
+        free_parsers_.pop_back();
+        return Lease(this, std::move(parser));
+      }
+    }
+    return Lease(this, create_parser());
+  }
+
+  /** Parse documents in memory, spread over the pool's threads.
+   *
+   * Returns when all documents have been parsed.
+   *
+   * @param documents A range of documents. Each element must be convertible
+   *        to std::string_view, such as std::string.
+   * @param on_parsed Called as <tt>on_parsed(std::size_t index, ParserType& parser)</tt>
+   *        after the document at position @a index in @a documents has been
+   *        parsed, with the parser that parsed it. It's called from several
+   *        threads at once. The parser is used for other documents afterwards.
+   * @returns For each document, the exception that was thrown by its parse or
+   *          by @a on_parsed, or <tt>nullptr</tt> if it was parsed successfully.
+   * @throws std::system_error If a thread can't be started.
+   */
+  template <typename Range, typename Function>
+  std::vector<std::exception_ptr> parse_all(const Range& documents, Function on_parsed)
+  {
+    std::vector<std::string_view> views;
+    for (const auto& document : documents)
+      views.emplace_back(document);
+
+    std::vector<std::exception_ptr> errors(views.size());
+    run_batch(views.size(), [&](unsigned int slot, std::size_t index)
+    {
+      try
+      {
+        auto& parser = slot_parsers_[slot];
+        if (!parser)
+          parser = create_parser();
+
+        const auto& document = views[index];
+        if (document.size() > std::numeric_limits<Parser::size_type>::max())
+          throw parse_error("Document is too large.");
+        parser->parse_memory_raw(reinterpret_cast<const unsigned char*>(document.data()),
+          static_cast<Parser::size_type>(document.size()));
+        on_parsed(index, *parser);
+      }
+      catch (...)
+      {
+        errors[index] = std::current_exception();
+      }
+    });
+    return errors;
+  }
+
+private:
+  std::unique_ptr<ParserType> create_parser()
+  {
+    auto parser = factory_ ? factory_() : std::make_unique<ParserType>();
+    parser->set_reuse_context();
+    return parser;
+  }
+
+  void give_back(std::unique_ptr<ParserType> parser) noexcept
+  {
+    try
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_parsers_.push_back(std::move(parser));
+    }
+    catch (...)
+    {
+      // Out of memory. The parser is deleted instead.
+    }
+  }
+
+  Factory factory_;
+  // The parsers of the threads that parse_all() uses, one per slot.
+  std::vector<std::unique_ptr<ParserType>> slot_parsers_;
+  // The parsers that acquire() can return.
+  std::vector<std::unique_ptr<ParserType>> free_parsers_;
+  std::mutex mutex_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_PARSERS_PARSERPOOL_H
@@ -0,0 +1,105 @@
+/* saxdispatchparser.cc
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+#include "libxml++/parsers/saxdispatchparser.h"
+
+namespace xmlpp {
+
+SaxDispatchParserBase::SaxDispatchParserBase()
+: mask_(0), multiplier_(0), shift_(0)
+{
+  set_namespace_callbacks();
+}
+
+SaxDispatchParserBase::~SaxDispatchParserBase()
+{
+}
+
+void SaxDispatchParserBase::set_element_names(const std::vector<ElementKey>& keys)
+{
+  slots_.clear();
+  entries_.clear();
+  if (keys.empty())
+    return;
+
+  // Group the keys by local name, keeping their order within each group,
+  // so that the first matching key wins.
+  std::vector<InternedName> local_names;
+  std::vector<std::vector<Entry>> groups;
+  for (std::size_t index = 0; index < keys.size(); ++index)
+  {
+    const auto local_name = intern(keys[index].local_name);
+    const bool any_namespace = keys[index].namespace_uri.empty();
+    const Entry entry{ any_namespace ? InternedName() : intern(keys[index].namespace_uri),
+      any_namespace, index };
+
+    std::size_t group = 0;
+    while (group < local_names.size() && local_names[group] != local_name)
+      ++group;
+    if (group == local_names.size())
+    {
+      local_names.push_back(local_name);
+      groups.emplace_back();
+    }
+    groups[group].push_back(entry);
+  }
+
+  for (const auto& group : groups)
+    entries_.insert(entries_.end(), group.begin(), group.end());
+
+  // At most half full.
+  unsigned int bits = 1;
+  while ((std::size_t(1) << bits) < 2 * local_names.size())
+    ++bits;
+  const std::size_t size = std::size_t(1) << bits;
+  mask_ = size - 1;
+  shift_ = 64 - bits;
+
+  // The interned strings are often stored close together in the dictionary.
+  // Try a few odd multipliers and keep the one with the shortest probe sequences.
+  const std::uint64_t candidates[] = {
+    0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull,
+    0xD6E8FEB86659FD93ull, 0xFF51AFD7ED558CCDull, 0xC4CEB9FE1A85EC53ull,
+  };
+  std::size_t best_cost = static_cast<std::size_t>(-1);
+  std::vector<Slot> best_slots;
+  std::uint64_t best_multiplier = candidates[0];
+  for (const auto candidate : candidates)
+  {
+    multiplier_ = candidate;
+    std::vector<Slot> slots(size);
+    std::size_t cost = 0;
+    std::size_t first_entry = 0;
+    for (std::size_t group = 0; group < local_names.size(); ++group)
+    {
+      auto i = slot_index(local_names[group].c_str());
+      while (slots[i].local_name)
+      {
+        i = (i + 1) & mask_;
+        ++cost;
+      }
+      slots[i].local_name = local_names[group];
+      slots[i].first_entry = first_entry;
+      first_entry += groups[group].size();
+      slots[i].end_entry = first_entry;
+    }
+
+    if (cost < best_cost)
+    {
+      best_cost = cost;
+      best_slots = std::move(slots);
+      best_multiplier = candidate;
+      if (cost == 0)
+        break;
+    }
+  }
+
+  slots_ = std::move(best_slots);
+  multiplier_ = best_multiplier;
+}
+
+} // namespace xmlpp
@@ -0,0 +1,219 @@
+/* saxdispatchparser.h
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+#ifndef __LIBXMLPP_PARSERS_SAXDISPATCHPARSER_H
+#define __LIBXMLPP_PARSERS_SAXDISPATCHPARSER_H
+
+#include <libxml++/parsers/saxviewparser.h>
+
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <vector>
+
+namespace xmlpp {
+
+/** Base class of SaxDispatchParser.
+ *
+ * Maps element names to indexes in a table that is built once, when the
+ * parser is constructed. The element names are interned in the parser's
+ * dictionary, and the table is an open-addressing hash table keyed by the
+ * interned pointers. A lookup costs one hash computation and usually one
+ * pointer comparison, however many element names there are. No strings are
+ * compared.
+ *
+ * Use SaxDispatchParser instead of deriving directly from this class.
+ *
+ * @newin{5,8}
+ */
+class SaxDispatchParserBase : public SaxViewParser
+{
+public:
+  /// The result of find_element() when no element name matches.
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  /// An element name, as registered with set_element_names().
+  struct ElementKey
+  {
+    std::string_view local_name;
+    /// The namespace URI. An empty string matches any namespace, and no namespace.
+    std::string_view namespace_uri;
+  };
+
+protected:
+  /** Calls set_namespace_callbacks(), which the lookup depends on.
+   */
+  LIBXMLPP_API
+  SaxDispatchParserBase();
+  LIBXMLPP_API
+  ~SaxDispatchParserBase() override;
+
+  /** Build the dispatch table.
+   * The index of each key in @a keys is what find_element() returns for it.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void set_element_names(const std::vector<ElementKey>& keys);
+
+  /** Look up an element name.
+   * @param name An element name, as passed to on_start_element_ns() or on_end_element_ns().
+   * @returns The index of the matching ElementKey, or npos if there is none.
+   */
+  std::size_t find_element(const QName& name) const noexcept
+  {
+    if (slots_.empty())
+      return npos;
+
+    // Linear probing. The table is at most half full, so there is always an empty slot.
+    for (auto i = slot_index(name.local_name.c_str());; i = (i + 1) & mask_)
+    {
+      const auto& slot = slots_[i];
+      if (slot.local_name == name.local_name)
+      {
+        for (auto e = slot.first_entry; e < slot.end_entry; ++e)
+        {
+          const auto& entry = entries_[e];
+          if (entry.any_namespace || entry.uri == name.uri)
+            return entry.index;
+        }
+        return npos;
+      }
+      if (!slot.local_name)
+        return npos;
+    }
+  }
+
+private:
+  struct Slot
+  {
+    InternedName local_name;
+    // Range in entries_ of the entries with this local name.
+    std::size_t first_entry = 0;
+    std::size_t end_entry = 0;
+  };
+
+  struct Entry
+  {
+    InternedName uri;
+    bool any_namespace;
+    std::size_t index;
+  };
+
+  std::size_t slot_index(const char* local_name) const noexcept
+  {
+    // Multiplicative hashing of the interned pointer.
+    const auto hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(local_name)) * multiplier_;
+    return static_cast<std::size_t>(hash >> shift_);
+  }
+
+  std::vector<Slot> slots_;
+  std::vector<Entry> entries_;
+  std::size_t mask_;
+  std::uint64_t multiplier_;
+  unsigned int shift_;
+};
+
+/** SAX parser that dispatches start and end element events through a table.
+ *
+ * Instead of comparing the element name with a long list of names in
+ * on_start_element(), register a member function per element name when the
+ * parser is constructed:
+ * @code
+ * class MyParser : public xmlpp::SaxDispatchParser<MyParser>
+ * {
+ * public:
+ *   MyParser()
+ *   : SaxDispatchParser({
+ *       { "book", &MyParser::on_start_book, &MyParser::on_end_book },
+ *       { "title", &MyParser::on_start_title, nullptr },
+ *     })
+ *   {}
+ *
+ * protected:
+ *   void on_start_book(const QName& name, const NsAttributeList& attributes);
+ *   ...
+ * };
+ * @endcode
+ * Each start and end element event then costs one table lookup.
+ *
+ * Elements that are not in the table are passed on to SaxViewParser::on_start_element_ns()
+ * and SaxViewParser::on_end_element_ns(), and from there to on_start_element() and
+ * on_end_element(), which a derived parser may still override.
+ *
+ * The namespace-aware callbacks are used (see SaxViewParser::set_namespace_callbacks()),
+ * and must not be switched off.
+ *
+ * @tparam Derived The derived parser class, whose member functions handle the events.
+ *
+ * @newin{5,8}
+ */
+template <typename Derived>
+class SaxDispatchParser : public SaxDispatchParserBase
+{
+public:
+  using StartHandler = void (Derived::*)(const QName& name, const NsAttributeList& attributes);
+  using EndHandler = void (Derived::*)(const QName& name);
+
+  /// The handlers of one element name.
+  struct Handler
+  {
+    Handler(std::string_view local_name_, StartHandler on_start_, EndHandler on_end_,
+      std::string_view namespace_uri_ = std::string_view())
+    : local_name(local_name_), on_start(on_start_), on_end(on_end_), namespace_uri(namespace_uri_)
+    {}
+
+    std::string_view local_name;
+    /// Called at the start of the element. May be nullptr.
+    StartHandler on_start;
+    /// Called at the end of the element. May be nullptr.
+    EndHandler on_end;
+    /// An empty string matches any namespace, and no namespace.
+    std::string_view namespace_uri;
+  };
+
+protected:
+  /** Build the dispatch table.
+   * If several handlers match an element, the first one is used.
+   * @param handlers The handlers, with the element names they handle.
+   * @throws xmlpp::internal_error
+   */
+  explicit SaxDispatchParser(std::initializer_list<Handler> handlers)
+  : handlers_(handlers)
+  {
+    std::vector<ElementKey> keys;
+    keys.reserve(handlers_.size());
+    for (const auto& handler : handlers_)
+      keys.push_back({ handler.local_name, handler.namespace_uri });
+    set_element_names(keys);
+  }
+
+  void on_start_element_ns(const QName& name, const NsAttributeList& attributes,
+    const NamespaceList& namespaces) override
+  {
+    const auto index = find_element(name);
+    if (index == npos)
+      SaxViewParser::on_start_element_ns(name, attributes, namespaces);
+    else if (const auto handler = handlers_[index].on_start)
+      (static_cast<Derived*>(this)->*handler)(name, attributes);
+  }
+
+  void on_end_element_ns(const QName& name) override
+  {
+    const auto index = find_element(name);
+    if (index == npos)
+      SaxViewParser::on_end_element_ns(name);
+    else if (const auto handler = handlers_[index].on_end)
+      (static_cast<Derived*>(this)->*handler)(name);
+  }
+
+private:
+  std::vector<Handler> handlers_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_PARSERS_SAXDISPATCHPARSER_H
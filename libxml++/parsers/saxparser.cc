@@ -8,14 +8,19 @@
  */
 
 #include "libxml++/parsers/saxparser.h"
+#include "libxml++/parsers/saxviewparser.h"
 #include "libxml++/nodes/element.h"
-#include "libxml++/keepblanks.h"
+#include "libxml++/io/istreamreader.h"
+#include "libxml++/io/mappedfile.h"
+#include "libxml++/validators/xsdvalidator.h"
 
 #include <libxml/parser.h>
 #include <libxml/parserInternals.h> // for xmlCreateFileParserCtxt
+#include <libxml/xmlschemas.h>
 
 #include <cstdarg> //For va_list.
 #include <iostream>
+#include <vector>
 
 namespace {
   extern "C" {
@@ -23,9 +28,7 @@ namespace {
                                  char * buffer,
                                  int len)
     {
-      auto in = static_cast<std::istream*>(context);
-      in->read(buffer, len);
-      return in->gcount();
+      return static_cast<xmlpp::IStreamReader*>(context)->read(buffer, len);
     }
   }
 }
@@ -45,15 +48,110 @@ struct SaxParserCallback
   static void warning(void* context, const char* fmt, ...);
   static void error(void* context, const char* fmt, ...);
   static void fatal_error(void* context, const char* fmt, ...);
+  // Used while an XSD validator is plugged into the parser.
+  static void plugged_error(void* user_data, xmlErrorPtr error);
   static void cdata_block(void* context, const xmlChar* value, int len);
   static void internal_subset(void* context, const xmlChar* name, const xmlChar*publicId, const xmlChar*systemId);
+
+  // Used if SaxViewParser::set_string_view_callbacks(true) has been called.
+  static void start_element_view(void* context, const xmlChar* name, const xmlChar** p);
+  static void end_element_view(void* context, const xmlChar* name);
+  static void characters_view(void* context, const xmlChar* ch, int len);
+  static void comment_view(void* context, const xmlChar* value);
+  static void cdata_block_view(void* context, const xmlChar* value, int len);
+  static void processing_instruction(void* context, const xmlChar* target, const xmlChar* data);
+
+  // Used if SaxViewParser::set_namespace_callbacks(true) has been called,
+  // or if patterns or an XSD validator are used.
+  static void start_element_ns(void* context, const xmlChar* localname, const xmlChar* prefix,
+    const xmlChar* uri, int nb_namespaces, const xmlChar** namespaces,
+    int nb_attributes, int nb_defaulted, const xmlChar** attributes);
+  static void end_element_ns(void* context, const xmlChar* localname, const xmlChar* prefix,
+    const xmlChar* uri);
+
+  // Used if SaxParser::set_coalesce_characters(true) has been called.
+  static void characters_coalesce(void* context, const xmlChar* ch, int len);
+  // Deliver the collected character data, if any. Called before every structural event.
+  static void flush_characters(SaxParser* parser);
+};
+
+// The SAX handler, extended with the state of the SaxParser.
+// It's stored in SaxParser::sax_handler_, so the layout of SaxParser is
+// not changed by the state added in libxml++ 5.8.
+struct SaxParser::Impl : public _xmlSAXHandler
+{
+  Impl() : _xmlSAXHandler() {}
+  Impl(const Impl&) = delete;
+  Impl& operator=(const Impl&) = delete;
+
+  // Whether SaxViewParser::set_namespace_callbacks(true) has been called.
+  bool namespace_callbacks_ = false;
+
+  // Adjacent character data, collected if set_coalesce_characters(true)
+  // has been called. Reused, to avoid an allocation per text node.
+  std::string characters_;
+
+  // Whether patterns have been added with SaxViewParser::add_pattern().
+  bool pattern_callbacks_ = false;
+
+  // The validator set with set_xsd_validator(), and its plug in the
+  // current parser context, if any.
+  XsdValidator* xsd_validator_ = nullptr;
+  xmlSchemaSAXPlugPtr xsd_plug_ = nullptr;
+
+  // Restore the SAX handler and user data of the parser context.
+  // Must be called before the context's SAX handler is replaced or freed.
+  void unplug_validator() noexcept
+  {
+    if (xsd_plug_)
+      xmlSchemaSAXUnplug(xsd_plug_);
+    xsd_plug_ = nullptr;
+  }
+
+  // Throw a validity_error if the last parse found the document invalid.
+  void check_validity()
+  {
+    if (xsd_validator_)
+      xsd_validator_->check_stream_validity();
+  }
+
+  // libxml2 calls startElementNs and endElementNs instead of startElement
+  // and endElement, if the handler is marked as a SAX2 handler.
+  // The namespace-aware interface is needed by the user's namespace-aware
+  // callbacks, by the patterns and by the XSD validator.
+  void update_sax2() noexcept
+  {
+    const bool sax2 = namespace_callbacks_ || xsd_validator_ || pattern_callbacks_;
+    initialized = sax2 ? XML_SAX2_MAGIC : 0;
+    startElementNs = sax2 ? SaxParserCallback::start_element_ns : nullptr;
+    endElementNs = sax2 ? SaxParserCallback::end_element_ns : nullptr;
+  }
 };
 
+namespace
+{
+// The prefixed name, as it's passed to SAX1 callbacks.
+std::string qualified_name(const SaxParser::InternedName& prefix, const SaxParser::InternedName& local_name)
+{
+  std::string result;
+  if (prefix)
+  {
+    result.reserve(prefix.view().size() + 1 + local_name.view().size());
+    result += prefix.view();
+    result += ':';
+  }
+  result += local_name.view();
+  return result;
+}
+} // anonymous namespace
+
 
 
 SaxParser::SaxParser(bool use_get_entity)
-  : sax_handler_(new _xmlSAXHandler), entity_resolver_doc_(new Document)
+  : entity_resolver_doc_(new Document)
 {
+  sax_handler_.reset(new Impl);
+
   xmlSAXHandler temp = {
     SaxParserCallback::internal_subset,
     nullptr, // isStandalone
@@ -97,6 +195,13 @@ SaxParser::SaxParser(bool use_get_entity)
 SaxParser::~SaxParser()
 {
   release_underlying();
+  delete impl();
+  sax_handler_.release();
+}
+
+SaxParser::Impl* SaxParser::impl() const noexcept
+{
+  return static_cast<Impl*>(sax_handler_.get());
 }
 
 xmlEntityPtr SaxParser::on_get_entity(const ustring& name)
@@ -151,6 +256,118 @@ void SaxParser::on_cdata_block(const ustring& /* text */)
 {
 }
 
+void SaxParser::set_view_callbacks(bool val) noexcept
+{
+  // Rewire the SAX handler, so the choice costs nothing per callback.
+  sax_handler_->startElement = val ? SaxParserCallback::start_element_view : SaxParserCallback::start_element;
+  sax_handler_->endElement = val ? SaxParserCallback::end_element_view : SaxParserCallback::end_element;
+  if (!get_coalesce_characters())
+    sax_handler_->characters = val ? SaxParserCallback::characters_view : SaxParserCallback::characters;
+  sax_handler_->comment = val ? SaxParserCallback::comment_view : SaxParserCallback::comment;
+  sax_handler_->cdataBlock = val ? SaxParserCallback::cdata_block_view : SaxParserCallback::cdata_block;
+}
+
+bool SaxParser::get_view_callbacks() const noexcept
+{
+  return sax_handler_->startElement == SaxParserCallback::start_element_view;
+}
+
+void SaxParser::set_processing_instruction_callback() noexcept
+{
+  sax_handler_->processingInstruction = SaxParserCallback::processing_instruction;
+}
+
+void SaxParser::start_element_sax1(const QName& name, const NsAttributeList& attributes,
+  const NamespaceList& namespaces)
+{
+  // Rebuild what a SAX1 parser would report: prefixed names, and the
+  // namespace declarations first among the attributes.
+  const auto element_name = qualified_name(name.prefix, name.local_name);
+
+  std::vector<std::string> strings;
+  strings.reserve(2 * (namespaces.size() + attributes.size()));
+  for (const auto& ns : namespaces)
+  {
+    strings.emplace_back(ns.prefix ? "xmlns:" + std::string(ns.prefix.view()) : "xmlns");
+    strings.emplace_back(ns.uri.view());
+  }
+  for (const auto& attribute : attributes)
+  {
+    strings.emplace_back(qualified_name(attribute.name.prefix, attribute.name.local_name));
+    strings.emplace_back(attribute.value);
+  }
+
+  if (get_view_callbacks())
+  {
+    std::vector<const unsigned char*> array;
+    array.reserve(strings.size() + 1);
+    for (const auto& str : strings)
+      array.push_back(reinterpret_cast<const unsigned char*>(str.c_str()));
+    array.push_back(nullptr);
+
+    static_cast<SaxViewParser*>(this)->on_start_element_view(element_name,
+      AttributeViewList(array.data()));
+  }
+  else
+  {
+    AttributeList attribute_list;
+    for (std::size_t i = 0; i < strings.size(); i += 2)
+      attribute_list.emplace_back(strings[i], strings[i + 1]);
+
+    on_start_element(element_name, attribute_list);
+  }
+}
+
+void SaxParser::end_element_sax1(const QName& name)
+{
+  if (get_view_callbacks())
+    static_cast<SaxViewParser*>(this)->on_end_element_view(qualified_name(name.prefix, name.local_name));
+  else
+    on_end_element(qualified_name(name.prefix, name.local_name));
+}
+
+void SaxParser::set_coalesce_characters(bool val) noexcept
+{
+  if (val)
+    sax_handler_->characters = SaxParserCallback::characters_coalesce;
+  else
+    sax_handler_->characters = get_view_callbacks() ?
+      SaxParserCallback::characters_view : SaxParserCallback::characters;
+}
+
+bool SaxParser::get_coalesce_characters() const noexcept
+{
+  return sax_handler_->characters == SaxParserCallback::characters_coalesce;
+}
+
+void SaxParser::set_ns_callbacks(bool val) noexcept
+{
+  impl()->namespace_callbacks_ = val;
+  impl()->update_sax2();
+}
+
+bool SaxParser::get_ns_callbacks() const noexcept
+{
+  return impl()->namespace_callbacks_;
+}
+
+void SaxParser::set_pattern_callbacks(bool val) noexcept
+{
+  impl()->pattern_callbacks_ = val;
+  impl()->update_sax2();
+}
+
+void SaxParser::set_xsd_validator(XsdValidator* validator) noexcept
+{
+  impl()->xsd_validator_ = validator;
+  impl()->update_sax2();
+}
+
+XsdValidator* SaxParser::get_xsd_validator() const noexcept
+{
+  return impl()->xsd_validator_;
+}
+
 void SaxParser::on_internal_subset(const ustring& name,
                          const ustring& publicId,
                          const ustring& systemId)
@@ -175,6 +392,7 @@ void SaxParser::parse()
 
   const int parseError = xmlParseDocument(context_);
 
+  impl()->unplug_validator();
   context_->sax = old_sax;
 
   auto error_str = format_xml_parser_error(context_);
@@ -189,6 +407,7 @@ void SaxParser::parse()
   {
     throw parse_error(error_str);
   }
+  impl()->check_validity();
 }
 
 void SaxParser::parse_file(const std::string& filename)
@@ -198,9 +417,19 @@ void SaxParser::parse_file(const std::string& filename)
     throw parse_error("Attempt to start a second parse while a parse is in progress.");
   }
 
-  KeepBlanks k(KeepBlanks::Default);
+  context_ = create_file_context(filename);
+  parse();
+}
 
-  context_ = xmlCreateFileParserCtxt(filename.c_str());
+void SaxParser::parse_mapped_file(const std::string& filename)
+{
+  if(context_)
+  {
+    throw parse_error("Attempt to start a second parse while a parse is in progress.");
+  }
+
+  MappedFile file(filename);
+  context_ = create_mapped_file_context(file);
   parse();
 }
 
@@ -211,9 +440,7 @@ void SaxParser::parse_memory_raw(const unsigned char* contents, size_type bytes_
     throw parse_error("Attempt to start a second parse while a parse is in progress.");
   }
 
-  KeepBlanks k(KeepBlanks::Default);
-
-  context_ = xmlCreateMemoryParserCtxt((const char*)contents, bytes_count);
+  context_ = create_memory_context(contents, bytes_count);
   parse();
 }
 
@@ -229,14 +456,14 @@ void SaxParser::parse_stream(std::istream& in)
     throw parse_error("Attempt to start a second parse while a parse is in progress.");
   }
 
-  KeepBlanks k(KeepBlanks::Default);
+  IStreamReader reader(in, get_stream_block_size(), get_stream_read_ahead());
 
   context_ = xmlCreateIOParserCtxt(
       sax_handler_.get(),
       nullptr, // user_data
       _io_read_callback,
       nullptr, // inputCloseCallback
-      &in,
+      &reader,
       XML_CHAR_ENCODING_NONE);
   parse();
 }
@@ -248,7 +475,6 @@ void SaxParser::parse_chunk(const ustring& chunk)
 
 void SaxParser::parse_chunk_raw(const unsigned char* contents, size_type bytes_count)
 {
-  KeepBlanks k(KeepBlanks::Default);
   xmlResetLastError();
 
   if(!context_)
@@ -310,6 +536,8 @@ void SaxParser::finish_chunk_parsing()
     //This is called just to terminate parsing.
     parseError = xmlParseChunk(context_, nullptr /* chunk */, 0 /* size */, 1 /* terminate (1 or 0) */);
 
+  impl()->unplug_validator();
+
   auto error_str = format_xml_parser_error(context_);
   if (error_str.empty() && parseError != XML_ERR_OK)
     error_str = "Error code from xmlParseChunk(): " + std::to_string(parseError);
@@ -322,10 +550,12 @@ void SaxParser::finish_chunk_parsing()
   {
     throw parse_error(error_str);
   }
+  impl()->check_validity();
 }
 
 void SaxParser::release_underlying()
 {
+  impl()->unplug_validator();
   Parser::release_underlying();
 }
 
@@ -334,6 +564,21 @@ void SaxParser::initialize_context()
   Parser::initialize_context();
   // Start with an empty Document for entity resolution.
   entity_resolver_doc_ = std::make_unique<Document>();
+  impl()->characters_.clear();
+
+  // The validator's SAX handler forwards all events to sax_handler_.
+  impl()->unplug_validator();
+  if (impl()->xsd_validator_)
+  {
+    impl()->xsd_plug_ = impl()->xsd_validator_->plug(context_);
+    // The validator's SAX handler can't forward the parser's warnings and
+    // errors, which take variable arguments. It prints "Unimplemented block"
+    // instead. Receive them as structured errors.
+    context_->sax->warning = nullptr;
+    context_->sax->error = nullptr;
+    context_->sax->fatalError = nullptr;
+    context_->sax->serror = SaxParserCallback::plugged_error;
+  }
 }
 
 
@@ -400,6 +645,7 @@ void SaxParserCallback::end_document(void* context)
 
   try
   {
+    flush_characters(parser);
     parser->on_end_document();
   }
   catch (...)
@@ -424,6 +670,7 @@ void SaxParserCallback::start_element(void* context,
 
   try
   {
+    flush_characters(parser);
     parser->on_start_element(ustring((const char*) name), attributes);
   }
   catch (...)
@@ -439,6 +686,7 @@ void SaxParserCallback::end_element(void* context, const xmlChar* name)
 
   try
   {
+    flush_characters(parser);
     parser->on_end_element(ustring((const char*) name));
   }
   catch (...)
@@ -475,6 +723,7 @@ void SaxParserCallback::comment(void* context, const xmlChar* value)
 
   try
   {
+    flush_characters(parser);
     parser->on_comment(ustring((const char*) value));
   }
   catch (...)
@@ -546,6 +795,39 @@ void SaxParserCallback::fatal_error(void* context, const char* fmt, ...)
   }
 }
 
+void SaxParserCallback::plugged_error(void* /* user_data */, xmlErrorPtr error)
+{
+  // user_data is the validator's plug. The error refers to the parser context.
+  auto the_context = static_cast<_xmlParserCtxt*>(error->ctxt);
+  if (!the_context)
+    return;
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  if (parser->exception_)
+    return;
+
+  const ustring buff = error->message ? error->message : "";
+  try
+  {
+    switch (error->level)
+    {
+      case XML_ERR_WARNING:
+        parser->on_warning(buff);
+        break;
+      case XML_ERR_FATAL:
+        parser->on_fatal_error(buff);
+        break;
+      default:
+        parser->on_error(buff);
+        break;
+    }
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
 void SaxParserCallback::cdata_block(void* context, const xmlChar* value, int len)
 {
   auto the_context = static_cast<_xmlParserCtxt*>(context);
@@ -553,6 +835,7 @@ void SaxParserCallback::cdata_block(void* context, const xmlChar* value, int len
 
   try
   {
+    flush_characters(parser);
     // Here we force the use of ustring::ustring( InputIterator begin, InputIterator end )
     // see comments in SaxParserCallback::characters
     parser->on_cdata_block(
@@ -585,4 +868,191 @@ void SaxParserCallback::internal_subset(void* context, const xmlChar* name,
   }
 }
 
+void SaxParserCallback::start_element_view(void* context,
+                                           const xmlChar* name,
+                                           const xmlChar** p)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    flush_characters(parser);
+    static_cast<SaxViewParser*>(parser)->on_start_element_view((const char*)name, SaxParser::AttributeViewList(p));
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::end_element_view(void* context, const xmlChar* name)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    flush_characters(parser);
+    static_cast<SaxViewParser*>(parser)->on_end_element_view((const char*)name);
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::characters_view(void* context, const xmlChar* ch, int len)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    static_cast<SaxViewParser*>(parser)->on_characters_view(std::string_view((const char*)ch, len));
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::comment_view(void* context, const xmlChar* value)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    flush_characters(parser);
+    static_cast<SaxViewParser*>(parser)->on_comment_view((const char*)value);
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::cdata_block_view(void* context, const xmlChar* value, int len)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    flush_characters(parser);
+    static_cast<SaxViewParser*>(parser)->on_cdata_block_view(std::string_view((const char*)value, len));
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::processing_instruction(void* context, const xmlChar* target,
+  const xmlChar* data)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    flush_characters(parser);
+    static_cast<SaxViewParser*>(parser)->on_processing_instruction((const char*)target,
+      data ? std::string_view((const char*)data) : std::string_view());
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::start_element_ns(void* context, const xmlChar* localname,
+  const xmlChar* prefix, const xmlChar* uri, int nb_namespaces, const xmlChar** namespaces,
+  int nb_attributes, int nb_defaulted, const xmlChar** attributes)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    flush_characters(parser);
+    const SaxParser::QName name =
+      { SaxParser::InternedName(localname), SaxParser::InternedName(prefix), SaxParser::InternedName(uri) };
+    const SaxParser::NsAttributeList attribute_list(attributes, nb_attributes, nb_defaulted);
+
+    if (parser->impl()->pattern_callbacks_)
+      static_cast<SaxViewParser*>(parser)->match_patterns(name, attribute_list);
+
+    const SaxParser::NamespaceList namespace_list(namespaces, nb_namespaces);
+    if (parser->impl()->namespace_callbacks_)
+      static_cast<SaxViewParser*>(parser)->on_start_element_ns(name, attribute_list, namespace_list);
+    else
+      parser->start_element_sax1(name, attribute_list, namespace_list);
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::end_element_ns(void* context, const xmlChar* localname,
+  const xmlChar* prefix, const xmlChar* uri)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  if (parser->impl()->pattern_callbacks_)
+    static_cast<SaxViewParser*>(parser)->pop_patterns();
+
+  try
+  {
+    flush_characters(parser);
+    const SaxParser::QName name =
+      { SaxParser::InternedName(localname), SaxParser::InternedName(prefix), SaxParser::InternedName(uri) };
+    if (parser->impl()->namespace_callbacks_)
+      static_cast<SaxViewParser*>(parser)->on_end_element_ns(name);
+    else
+      parser->end_element_sax1(name);
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::characters_coalesce(void* context, const xmlChar* ch, int len)
+{
+  auto the_context = static_cast<_xmlParserCtxt*>(context);
+  auto parser = static_cast<SaxParser*>(the_context->_private);
+
+  try
+  {
+    parser->impl()->characters_.append((const char*)ch, len);
+  }
+  catch (...)
+  {
+    parser->handle_exception();
+  }
+}
+
+void SaxParserCallback::flush_characters(SaxParser* parser)
+{
+  auto& characters = parser->impl()->characters_;
+  if (characters.empty())
+    return;
+
+  // Empty the buffer even if the callback throws, but keep its capacity.
+  struct Clear
+  {
+    std::string& str;
+    ~Clear() { str.clear(); }
+  } clear{characters};
+
+  if (parser->get_view_callbacks())
+    static_cast<SaxViewParser*>(parser)->on_characters_view(characters);
+  else
+    parser->on_characters(characters);
+}
+
 } // namespace xmlpp
@@ -10,7 +10,9 @@
 #include <libxml++/parsers/parser.h>
 
 #include <deque>
+#include <iterator>
 #include <memory>
+#include <string_view>
 #include "libxml++/document.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -22,6 +24,8 @@ extern "C" {
 
 namespace xmlpp {
 
+class XsdValidator;
+
 /** SAX XML parser.
  * Derive your own class and override the on_*() methods.
  * SAX = Simple API for XML
@@ -75,6 +79,309 @@ public:
     }
   };
 
+  /** Attribute used in the SaxViewParser::on_start_element_view() callback.
+   * The strings point into the parser's own buffers. They are valid only
+   * during the callback, and must be copied if they are needed later.
+   *
+   * @newin{5,8}
+   */
+  struct AttributeView
+  {
+    std::string_view name;
+    std::string_view value;
+  };
+
+  /** Non-owning list of the attributes of an element.
+   * Used in the SaxViewParser::on_start_element_view() callback. No memory
+   * is allocated when it is created or iterated over. It is valid only during
+   * the callback.
+   *
+   * @newin{5,8}
+   */
+  class AttributeViewList
+  {
+  public:
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = AttributeView;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const AttributeView*;
+      using reference = AttributeView;
+
+      const_iterator() noexcept = default;
+      explicit const_iterator(const unsigned char* const* cur) noexcept
+        : cur_(cur)
+        {
+        }
+
+      AttributeView operator*() const noexcept
+      {
+        return { to_view(cur_[0]), to_view(cur_[1]) };
+      }
+
+      const_iterator& operator++() noexcept
+      {
+        cur_ += 2;
+        return *this;
+      }
+
+      const_iterator operator++(int) noexcept
+      {
+        auto tmp = *this;
+        cur_ += 2;
+        return tmp;
+      }
+
+      bool operator==(const const_iterator& other) const noexcept { return cur_ == other.cur_; }
+      bool operator!=(const const_iterator& other) const noexcept { return cur_ != other.cur_; }
+
+    private:
+      static std::string_view to_view(const unsigned char* str) noexcept
+      {
+        return str ? std::string_view(reinterpret_cast<const char*>(str)) : std::string_view();
+      }
+
+      const unsigned char* const* cur_ = nullptr;
+    };
+
+    using size_type = std::size_t;
+
+    /** Create a list from a libxml2 attribute array.
+     * @param attributes A nullptr-terminated array of name/value pairs, or nullptr.
+     */
+    explicit AttributeViewList(const unsigned char* const* attributes) noexcept
+      : begin_(attributes), end_(attributes)
+      {
+        if (end_)
+          while (*end_)
+            end_ += 2;
+      }
+
+    const_iterator begin() const noexcept { return const_iterator(begin_); }
+    const_iterator end() const noexcept { return const_iterator(end_); }
+    bool empty() const noexcept { return begin_ == end_; }
+    size_type size() const noexcept { return (end_ - begin_) / 2; }
+
+    /** Find an attribute by name.
+     * @param name The attribute's name, including a namespace prefix, if any.
+     * @returns An iterator to the attribute, or end() if not found.
+     */
+    const_iterator find(std::string_view name) const noexcept
+    {
+      auto it = begin();
+      for (const auto stop = end(); it != stop; ++it)
+        if ((*it).name == name)
+          break;
+      return it;
+    }
+
+  private:
+    const unsigned char* const* begin_;
+    const unsigned char* const* end_;
+  };
+
+  /** A string interned in the parser's dictionary.
+   *
+   * Equal strings interned in the same SaxViewParser have the same address,
+   * so two %InternedName instances are compared by pointer, without
+   * comparing the characters. Get an %InternedName for a string that shall
+   * be compared with the names passed to SaxViewParser::on_start_element_ns()
+   * and SaxViewParser::on_end_element_ns() with SaxViewParser::intern().
+   *
+   * A default-constructed %InternedName represents a missing value,
+   * such as a missing namespace prefix.
+   *
+   * @newin{5,8}
+   */
+  class InternedName
+  {
+  public:
+    InternedName() noexcept
+      : str_(nullptr)
+      {
+      }
+
+    explicit InternedName(const unsigned char* str) noexcept
+      : str_(reinterpret_cast<const char*>(str))
+      {
+      }
+
+    /// The string, or an empty string if the value is missing.
+    const char* c_str() const noexcept { return str_ ? str_ : ""; }
+    std::string_view view() const noexcept { return str_ ? std::string_view(str_) : std::string_view(); }
+    bool empty() const noexcept { return !str_ || !*str_; }
+
+    /// Whether a value is present.
+    explicit operator bool() const noexcept { return str_ != nullptr; }
+
+    bool operator==(const InternedName& other) const noexcept { return str_ == other.str_; }
+    bool operator!=(const InternedName& other) const noexcept { return str_ != other.str_; }
+
+  private:
+    const char* str_;
+  };
+
+  /** A namespace-qualified name, split by the parser.
+   *
+   * @newin{5,8}
+   */
+  struct QName
+  {
+    InternedName local_name;
+    InternedName prefix;
+    InternedName uri;
+  };
+
+  /** Attribute used in the SaxViewParser::on_start_element_ns() callback.
+   *
+   * @newin{5,8}
+   */
+  struct NsAttributeView
+  {
+    QName name;
+    /// The value. It's valid only during the callback.
+    std::string_view value;
+    /// Whether the attribute was not in the document, but was added from a DTD default value.
+    bool defaulted;
+  };
+
+  /** Namespace declaration used in the SaxViewParser::on_start_element_ns() callback.
+   *
+   * @newin{5,8}
+   */
+  struct NamespaceDeclaration
+  {
+    /// The declared prefix, or no value for a default namespace declaration.
+    InternedName prefix;
+    InternedName uri;
+  };
+
+  /** Iterator over one of the lists used in the SaxViewParser::on_start_element_ns() callback.
+   *
+   * @newin{5,8}
+   */
+  template <typename List, typename Value>
+  class IndexIterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Value*;
+    using reference = Value;
+
+    IndexIterator() noexcept = default;
+    IndexIterator(const List* list, std::size_t index) noexcept
+      : list_(list), index_(index)
+      {
+      }
+
+    Value operator*() const noexcept { return (*list_)[index_]; }
+    IndexIterator& operator++() noexcept { ++index_; return *this; }
+    IndexIterator operator++(int) noexcept { auto tmp = *this; ++index_; return tmp; }
+    bool operator==(const IndexIterator& other) const noexcept { return index_ == other.index_; }
+    bool operator!=(const IndexIterator& other) const noexcept { return index_ != other.index_; }
+
+  private:
+    const List* list_ = nullptr;
+    std::size_t index_ = 0;
+  };
+
+  /** Non-owning list of the attributes of an element.
+   * Used in the SaxViewParser::on_start_element_ns() callback. It is valid only during the callback.
+   *
+   * @newin{5,8}
+   */
+  class NsAttributeList
+  {
+  public:
+    using size_type = std::size_t;
+    using const_iterator = IndexIterator<NsAttributeList, NsAttributeView>;
+
+    /** Create a list from a libxml2 SAX2 attribute array.
+     * @param attributes An array of localname/prefix/URI/value/end quintuples.
+     * @param count The number of attributes.
+     * @param defaulted_count The number of defaulted attributes at the end of the array.
+     */
+    NsAttributeList(const unsigned char* const* attributes, size_type count, size_type defaulted_count) noexcept
+      : attributes_(attributes), count_(count), defaulted_count_(defaulted_count)
+      {
+      }
+
+    NsAttributeView operator[](size_type index) const noexcept
+    {
+      const auto attr = attributes_ + 5 * index;
+      return {
+        { InternedName(attr[0]), InternedName(attr[1]), InternedName(attr[2]) },
+        std::string_view(reinterpret_cast<const char*>(attr[3]), attr[4] - attr[3]),
+        index >= count_ - defaulted_count_ };
+    }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, count_); }
+    bool empty() const noexcept { return count_ == 0; }
+    size_type size() const noexcept { return count_; }
+
+    /** Find an attribute by local name and namespace URI.
+     * @param local_name The attribute's local name, interned with SaxViewParser::intern().
+     * @param uri The attribute's namespace URI, interned with SaxViewParser::intern(),
+     *        or no value for an attribute without a namespace.
+     * @returns An iterator to the attribute, or end() if not found.
+     */
+    const_iterator find(const InternedName& local_name, const InternedName& uri = InternedName()) const noexcept
+    {
+      for (size_type i = 0; i < count_; ++i)
+      {
+        const auto attr = attributes_ + 5 * i;
+        if (InternedName(attr[0]) == local_name && InternedName(attr[2]) == uri)
+          return const_iterator(this, i);
+      }
+      return end();
+    }
+
+  private:
+    const unsigned char* const* attributes_;
+    size_type count_;
+    size_type defaulted_count_;
+  };
+
+  /** Non-owning list of the namespace declarations of an element.
+   * Used in the SaxViewParser::on_start_element_ns() callback. It is valid only during the callback.
+   *
+   * @newin{5,8}
+   */
+  class NamespaceList
+  {
+  public:
+    using size_type = std::size_t;
+    using const_iterator = IndexIterator<NamespaceList, NamespaceDeclaration>;
+
+    /** Create a list from a libxml2 SAX2 namespace array.
+     * @param namespaces An array of prefix/URI pairs.
+     * @param count The number of namespace declarations.
+     */
+    NamespaceList(const unsigned char* const* namespaces, size_type count) noexcept
+      : namespaces_(namespaces), count_(count)
+      {
+      }
+
+    NamespaceDeclaration operator[](size_type index) const noexcept
+    {
+      return { InternedName(namespaces_[2 * index]), InternedName(namespaces_[2 * index + 1]) };
+    }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, count_); }
+    bool empty() const noexcept { return count_ == 0; }
+    size_type size() const noexcept { return count_; }
+
+  private:
+    const unsigned char* const* namespaces_;
+    size_type count_;
+  };
+
   /**
    * @param use_get_entity Set this to true if you will override on_get_entity().
    * In theory, if you do not override on_get_entity() the parser should behave exactly the same
@@ -96,6 +403,24 @@ public:
   LIBXMLPP_API
   void parse_file(const std::string& filename) override;
 
+  /** Parse an XML document from a memory-mapped file.
+   *
+   * The file is parsed directly from the operating system's page cache,
+   * without read() calls. With libxml2 2.13 and later, files smaller than
+   * 2 GiB are parsed in place, without being copied into the parser's input
+   * buffer. Otherwise the parser copies blocks from the mapping as it needs
+   * them. See MappedFile.
+   *
+   * @newin{5,8}
+   *
+   * @param filename The path to the file.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::parse_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void parse_mapped_file(const std::string& filename);
+
   /** Parse an XML document from a string.
    * @param contents The XML document as a string.
    * @throws xmlpp::internal_error
@@ -172,6 +497,66 @@ public:
   LIBXMLPP_API
   void finish_chunk_parsing();
 
+  /** Set whether adjacent character data shall be delivered in one call.
+   *
+   * libxml2 often reports the text of one text node in several pieces,
+   * for instance at input buffer boundaries and around entity references.
+   * By default each piece results in a call to on_characters() (or
+   * SaxViewParser::on_characters_view()). If this is set, the pieces are
+   * collected in a buffer, which is reused, and delivered in one call to
+   * on_characters() (or SaxViewParser::on_characters_view()) just before the
+   * next start element, end element, comment or CDATA event.
+   *
+   * Call this method before the parse starts.
+   *
+   * @newin{5,8}
+   *
+   * @param val Whether adjacent character data shall be coalesced.
+   */
+  LIBXMLPP_API
+  void set_coalesce_characters(bool val = true) noexcept;
+
+  /** See set_coalesce_characters().
+   *
+   * @newin{5,8}
+   *
+   * @returns Whether adjacent character data will be coalesced.
+   */
+  LIBXMLPP_API
+  bool get_coalesce_characters() const noexcept;
+
+  /** Validate the document against an XSD schema while it's parsed.
+   *
+   * The validator is plugged into the parser's stream of SAX events, so the
+   * document is validated in the same pass as it's parsed, without building
+   * a Document. This works also with parse_chunk() and parse_stream().
+   * If the document is well-formed but not valid, the parse method throws
+   * a validity_error with the validator's messages when the parse is done.
+   * The parser's own messages are passed to on_warning(), on_error() or
+   * on_fatal_error(), depending on their level.
+   *
+   * While a validator is set, the parser uses libxml2's namespace-aware
+   * interface, but the callbacks that are called for the elements are
+   * unchanged. Call this method before the parse starts. The validator must
+   * contain a schema when the parse starts, and it must not be deleted while
+   * it's used by this parser.
+   *
+   * @newin{5,8}
+   *
+   * @param validator The validator, or <tt>nullptr</tt> to stop validating.
+   */
+  LIBXMLPP_API
+  void set_xsd_validator(XsdValidator* validator) noexcept;
+
+  /** See set_xsd_validator().
+   *
+   * @newin{5,8}
+   *
+   * @returns The validator, or <tt>nullptr</tt>.
+   */
+  LIBXMLPP_API
+  XsdValidator* get_xsd_validator() const noexcept;
+
 protected:
 
   LIBXMLPP_API
@@ -244,6 +629,23 @@ private:
   LIBXMLPP_API
   void parse();
 
+  // Used by SaxViewParser.
+  void set_view_callbacks(bool val) noexcept;
+  bool get_view_callbacks() const noexcept;
+  void set_ns_callbacks(bool val) noexcept;
+  bool get_ns_callbacks() const noexcept;
+  void set_pattern_callbacks(bool val) noexcept;
+  void set_processing_instruction_callback() noexcept;
+  // Rebuild the prefixed names, and call the view or the ustring callbacks.
+  void start_element_sax1(const QName& name, const NsAttributeList& attributes,
+    const NamespaceList& namespaces);
+  void end_element_sax1(const QName& name);
+
+  // The SAX handler and the rest of the parser's state.
+  struct Impl;
+  Impl* impl() const noexcept;
+
+  // Points to an Impl.
   std::unique_ptr<_xmlSAXHandler> sax_handler_;
 
   // A separate xmlpp::Document that is just used for entity resolution,
@@ -251,6 +653,7 @@ private:
   std::unique_ptr<Document> entity_resolver_doc_;
 
   friend struct SaxParserCallback;
+  friend class SaxViewParser;
 };
 
 } // namespace xmlpp
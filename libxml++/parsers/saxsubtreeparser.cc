@@ -0,0 +1,198 @@
+/* saxsubtreeparser.cc
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+#include "libxml++/parsers/saxsubtreeparser.h"
+#include "libxml++/exceptions/internal_error.h"
+
+#include <libxml/SAX2.h> // xmlSAX2GetLineNumber()
+#include <libxml/tree.h>
+
+#include <climits> // USHRT_MAX
+
+namespace
+{
+// Find a namespace declaration with this prefix and URI in scope of the node.
+// If the prefix is not declared in the subtree, it's inherited from outside
+// the subtree, and it's declared on the root element of the subtree.
+xmlNs* get_ns(xmlNode* node, const char* prefix, const char* uri)
+{
+  auto ns = xmlSearchNs(node->doc, node, (const xmlChar*)prefix);
+  if (ns && xmlStrEqual(ns->href, (const xmlChar*)uri))
+    return ns;
+  auto owner = ns ? node : xmlDocGetRootElement(node->doc);
+  ns = xmlNewNs(owner, (const xmlChar*)uri, (const xmlChar*)prefix);
+  if (!ns)
+    throw xmlpp::internal_error("Could not declare a namespace.");
+  return ns;
+}
+} // anonymous namespace
+
+namespace xmlpp {
+
+SaxSubtreeParser::SaxSubtreeParser(const ustring& pattern, const Node::PrefixNsMap& namespaces)
+: pattern_(pattern, namespaces)
+{
+  set_string_view_callbacks();
+  set_namespace_callbacks();
+  add_pattern(pattern_);
+}
+
+SaxSubtreeParser::~SaxSubtreeParser()
+{
+}
+
+void SaxSubtreeParser::on_subtree(std::unique_ptr<Document> /* document */)
+{
+}
+
+void SaxSubtreeParser::on_start_document()
+{
+  // Discard what's left of a parse that has been stopped by an error.
+  document_.reset();
+  current_ = nullptr;
+  start_pending_ = false;
+  SaxViewParser::on_start_document();
+}
+
+void SaxSubtreeParser::on_pattern_match(std::size_t /* pattern_index */,
+  const QName& /* name */, const NsAttributeList& /* attributes */)
+{
+  if (!document_)
+    start_pending_ = true;
+}
+
+void SaxSubtreeParser::add_child(xmlNode* node)
+{
+  if (!node)
+    throw internal_error("Could not create a node.");
+  // Don't let xmlAddChild() merge text nodes, and free the new node.
+  // Adjacent text is concatenated by on_characters_view().
+  node->parent = current_;
+  if (current_->last)
+  {
+    node->prev = current_->last;
+    current_->last->next = node;
+  }
+  else
+    current_->children = node;
+  current_->last = node;
+}
+
+void SaxSubtreeParser::on_start_element_ns(const QName& name, const NsAttributeList& attributes,
+  const NamespaceList& namespaces)
+{
+  if (start_pending_)
+  {
+    start_pending_ = false;
+    document_ = std::make_unique<Document>();
+    current_ = reinterpret_cast<xmlNode*>(document_->cobj());
+  }
+  if (!document_)
+  {
+    SaxViewParser::on_start_element_ns(name, attributes, namespaces);
+    return;
+  }
+
+  const auto doc = document_->cobj();
+  auto node = xmlNewDocNode(doc, nullptr, (const xmlChar*)name.local_name.c_str(), nullptr);
+  add_child(node);
+  const long line = xmlSAX2GetLineNumber(context_);
+  node->line = static_cast<unsigned short>(line < USHRT_MAX ? line : USHRT_MAX);
+
+  for (const auto& declaration : namespaces)
+    if (!xmlNewNs(node, (const xmlChar*)declaration.uri.c_str(),
+      declaration.prefix ? (const xmlChar*)declaration.prefix.c_str() : nullptr))
+      throw internal_error("Could not declare a namespace.");
+
+  if (name.uri)
+    node->ns = get_ns(node, name.prefix ? name.prefix.c_str() : nullptr, name.uri.c_str());
+
+  for (const auto& attribute : attributes)
+  {
+    xmlNs* ns = nullptr;
+    if (attribute.name.uri)
+      ns = get_ns(node, attribute.name.prefix.c_str(), attribute.name.uri.c_str());
+    buffer_.assign(attribute.value);
+    if (!xmlNewNsProp(node, ns, (const xmlChar*)attribute.name.local_name.c_str(),
+      (const xmlChar*)buffer_.c_str()))
+      throw internal_error("Could not create an attribute.");
+  }
+
+  current_ = node;
+}
+
+void SaxSubtreeParser::on_end_element_ns(const QName& name)
+{
+  if (!document_)
+  {
+    SaxViewParser::on_end_element_ns(name);
+    return;
+  }
+
+  current_ = current_->parent;
+  if (current_->type == XML_DOCUMENT_NODE)
+  {
+    // The root element has ended.
+    current_ = nullptr;
+    on_subtree(std::move(document_));
+  }
+}
+
+void SaxSubtreeParser::on_characters_view(std::string_view characters)
+{
+  if (!document_)
+  {
+    SaxViewParser::on_characters_view(characters);
+    return;
+  }
+
+  const auto last = current_->last;
+  if (last && last->type == XML_TEXT_NODE)
+    xmlNodeAddContentLen(last, (const xmlChar*)characters.data(), static_cast<int>(characters.size()));
+  else
+    add_child(xmlNewDocTextLen(document_->cobj(), (const xmlChar*)characters.data(),
+      static_cast<int>(characters.size())));
+}
+
+void SaxSubtreeParser::on_comment_view(std::string_view text)
+{
+  if (!document_)
+  {
+    SaxViewParser::on_comment_view(text);
+    return;
+  }
+
+  buffer_.assign(text);
+  add_child(xmlNewDocComment(document_->cobj(), (const xmlChar*)buffer_.c_str()));
+}
+
+void SaxSubtreeParser::on_processing_instruction(std::string_view target, std::string_view data)
+{
+  if (!document_)
+  {
+    SaxViewParser::on_processing_instruction(target, data);
+    return;
+  }
+
+  // Both strings are null-terminated.
+  add_child(xmlNewDocPI(document_->cobj(), (const xmlChar*)target.data(),
+    data.empty() ? nullptr : (const xmlChar*)data.data()));
+}
+
+void SaxSubtreeParser::on_cdata_block_view(std::string_view text)
+{
+  if (!document_)
+  {
+    SaxViewParser::on_cdata_block_view(text);
+    return;
+  }
+
+  add_child(xmlNewCDataBlock(document_->cobj(), (const xmlChar*)text.data(),
+    static_cast<int>(text.size())));
+}
+
+} // namespace xmlpp
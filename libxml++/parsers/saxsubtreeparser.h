@@ -0,0 +1,126 @@
+/* saxsubtreeparser.h
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+#ifndef __LIBXMLPP_PARSERS_SAXSUBTREEPARSER_H
+#define __LIBXMLPP_PARSERS_SAXSUBTREEPARSER_H
+
+#include <libxml++/parsers/saxviewparser.h>
+#include <libxml++/xpathpattern.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlNode;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp {
+
+/** SAX parser that builds a Document of each element that matches a pattern.
+ *
+ * Only the subtrees of the matching elements are built, each one as a small
+ * standalone Document, and handed to on_subtree(). Everything else is
+ * discarded while parsing, so a feed of any size can be processed one record
+ * at a time, with the full DOM and XPath API for each record:
+ * @code
+ * class EntryParser : public xmlpp::SaxSubtreeParser
+ * {
+ * public:
+ *   EntryParser() : SaxSubtreeParser("/feed/entry") {}
+ *
+ * protected:
+ *   void on_subtree(std::unique_ptr<xmlpp::Document> document) override
+ *   {
+ *     auto entry = document->get_root_node();
+ *     if (entry->exists("@type = 'x'"))
+ *       std::cout << entry->eval_to_string("id") << std::endl;
+ *   }
+ * };
+ * @endcode
+ *
+ * The namespaces that are used in a subtree, but declared outside it, are
+ * declared on the root element of the Document. An element that matches the
+ * pattern inside a subtree that is being built is not handed over separately.
+ *
+ * Elements, attributes, text, CDATA sections, comments and processing
+ * instructions are added to the Document. An entity reference is replaced by
+ * the entity's content, as libxml2 reports it to a SAX parser.
+ *
+ * Events outside of the subtrees are passed on to the SaxViewParser callbacks,
+ * which a derived parser may still override. Events inside of the subtrees
+ * are not. If on_start_document() is overridden, the override must call
+ * SaxSubtreeParser::on_start_document().
+ *
+ * The namespace-aware callbacks and the string view callbacks are used
+ * (see SaxViewParser::set_namespace_callbacks() and SaxViewParser::set_string_view_callbacks()),
+ * and must not be switched off.
+ *
+ * @newin{5,8}
+ */
+class SaxSubtreeParser : public SaxViewParser
+{
+public:
+  /** Create a parser.
+   * @param pattern The pattern of the elements whose subtrees are built. See XPathPattern.
+   * @param namespaces A map of namespace prefixes to namespace URIs, used in the pattern.
+   * @throws xmlpp::exception If the pattern cannot be compiled, or is not streamable.
+   */
+  LIBXMLPP_API
+  explicit SaxSubtreeParser(const ustring& pattern,
+    const Node::PrefixNsMap& namespaces = Node::PrefixNsMap());
+
+  LIBXMLPP_API
+  ~SaxSubtreeParser() override;
+
+protected:
+  /** Called with the Document of each matching element, when the element ends.
+   * The default implementation does nothing.
+   * @param document A Document, whose root node is the matching element.
+   */
+  LIBXMLPP_API
+  virtual void on_subtree(std::unique_ptr<Document> document);
+
+  LIBXMLPP_API
+  void on_start_document() override;
+  LIBXMLPP_API
+  void on_pattern_match(std::size_t pattern_index, const QName& name,
+    const NsAttributeList& attributes) override;
+  LIBXMLPP_API
+  void on_start_element_ns(const QName& name, const NsAttributeList& attributes,
+    const NamespaceList& namespaces) override;
+  LIBXMLPP_API
+  void on_end_element_ns(const QName& name) override;
+  LIBXMLPP_API
+  void on_characters_view(std::string_view characters) override;
+  LIBXMLPP_API
+  void on_comment_view(std::string_view text) override;
+  LIBXMLPP_API
+  void on_cdata_block_view(std::string_view text) override;
+  LIBXMLPP_API
+  void on_processing_instruction(std::string_view target, std::string_view data) override;
+
+private:
+  // Add a node as the last child of current_.
+  void add_child(_xmlNode* node);
+
+  const XPathPattern pattern_;
+  // The subtree that is being built, if any.
+  std::unique_ptr<Document> document_;
+  // The innermost open element of the subtree, or the document node.
+  _xmlNode* current_ = nullptr;
+  // Whether the next element starts a subtree.
+  bool start_pending_ = false;
+  // Reused for strings that libxml2 wants to be null-terminated.
+  std::string buffer_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_PARSERS_SAXSUBTREEPARSER_H
@@ -0,0 +1,223 @@
+/* saxviewparser.cc
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+// Direct access to xmlParserCtxt::dict and xmlParserCtxt::str_xml*
+// is deprecated since libxml2 2.14.0.
+// Ignore deprecations here.
+#define XML_DEPRECATED_MEMBER
+
+#include "libxml++/parsers/saxviewparser.h"
+#include "libxml++/xpathpattern.h"
+
+#include <libxml/parser.h>
+#include <libxml/pattern.h>
+
+#include <vector>
+
+namespace xmlpp {
+
+struct SaxViewParser::Impl
+{
+  Impl() = default;
+  Impl(const Impl&) = delete;
+  Impl& operator=(const Impl&) = delete;
+
+  ~Impl()
+  {
+    free_streams();
+    if (dict_)
+      xmlDictFree(dict_);
+  }
+
+  // The names interned with intern(). Created on demand.
+  xmlDictPtr dict_ = nullptr;
+
+  // Patterns added with add_pattern(), and their states in the current parse.
+  struct PatternStream
+  {
+    const XPathPattern* pattern;
+    xmlStreamCtxtPtr stream;
+  };
+  std::vector<PatternStream> patterns_;
+
+  void free_streams() noexcept
+  {
+    for (auto& pattern : patterns_)
+    {
+      if (pattern.stream)
+        xmlFreeStreamCtxt(pattern.stream);
+      pattern.stream = nullptr;
+    }
+  }
+};
+
+SaxViewParser::SaxViewParser(bool use_get_entity)
+: SaxParser(use_get_entity), pimpl_(new Impl)
+{
+  set_processing_instruction_callback();
+}
+
+SaxViewParser::~SaxViewParser()
+{
+}
+
+void SaxViewParser::set_string_view_callbacks(bool val) noexcept
+{
+  set_view_callbacks(val);
+}
+
+bool SaxViewParser::get_string_view_callbacks() const noexcept
+{
+  return get_view_callbacks();
+}
+
+void SaxViewParser::set_namespace_callbacks(bool val) noexcept
+{
+  set_ns_callbacks(val);
+}
+
+bool SaxViewParser::get_namespace_callbacks() const noexcept
+{
+  return get_ns_callbacks();
+}
+
+SaxParser::InternedName SaxViewParser::intern(std::string_view str)
+{
+  if (!pimpl_->dict_)
+  {
+    pimpl_->dict_ = xmlDictCreate();
+    if (!pimpl_->dict_)
+      throw internal_error("Could not create a dictionary.");
+  }
+
+  const auto result = xmlDictLookup(pimpl_->dict_, (const xmlChar*)str.data(), static_cast<int>(str.size()));
+  if (!result)
+    throw internal_error("Could not intern a string.");
+  return InternedName(result);
+}
+
+std::size_t SaxViewParser::add_pattern(const XPathPattern& pattern)
+{
+  pimpl_->patterns_.push_back({ &pattern, nullptr });
+  set_pattern_callbacks(true);
+  return pimpl_->patterns_.size() - 1;
+}
+
+void SaxViewParser::clear_patterns() noexcept
+{
+  pimpl_->free_streams();
+  pimpl_->patterns_.clear();
+  set_pattern_callbacks(false);
+}
+
+void SaxViewParser::initialize_context()
+{
+  if (pimpl_->dict_)
+  {
+    // Give the context a dictionary of its own, on top of the dictionary of
+    // interned names. A name that has been interned is found in the interned
+    // names, so the names passed to on_start_element_ns(), on_end_element_ns()
+    // and on_pattern_match() can be compared with names from intern(). Other
+    // names are added to the context's dictionary, which is freed with the
+    // context. The cached names that the context compares by pointer must
+    // be looked up in the new dictionary.
+    auto dict = xmlDictCreateSub(pimpl_->dict_);
+    if (!dict)
+      throw internal_error("Could not create a dictionary.");
+    xmlDictFree(context_->dict);
+    context_->dict = dict;
+    context_->str_xml = xmlDictLookup(dict, (const xmlChar*)"xml", 3);
+    context_->str_xmlns = xmlDictLookup(dict, (const xmlChar*)"xmlns", 5);
+    context_->str_xml_ns = xmlDictLookup(dict, XML_XML_NAMESPACE, 36);
+  }
+
+  SaxParser::initialize_context();
+
+  // Each parse starts at the document node.
+  pimpl_->free_streams();
+  for (auto& pattern : pimpl_->patterns_)
+  {
+    pattern.stream = xmlPatternGetStreamCtxt(const_cast<xmlPattern*>(pattern.pattern->cobj()));
+    if (!pattern.stream)
+      throw internal_error("Could not create a stream for the pattern " +
+        pattern.pattern->get_pattern());
+    // A null name and namespace is the document node, where
+    // absolute paths start.
+    xmlStreamPush(pattern.stream, nullptr, nullptr);
+  }
+}
+
+void SaxViewParser::match_patterns(const QName& name, const NsAttributeList& attributes)
+{
+  const auto localname = (const xmlChar*)name.local_name.c_str();
+  const auto uri = name.uri ? (const xmlChar*)name.uri.c_str() : nullptr;
+  auto& patterns = pimpl_->patterns_;
+  for (std::size_t i = 0; i < patterns.size(); ++i)
+  {
+    // Every element is pushed, and popped in pop_patterns().
+    if (patterns[i].stream && xmlStreamPush(patterns[i].stream, localname, uri) == 1)
+      on_pattern_match(i, name, attributes);
+  }
+}
+
+void SaxViewParser::pop_patterns() noexcept
+{
+  for (auto& pattern : pimpl_->patterns_)
+    if (pattern.stream)
+      xmlStreamPop(pattern.stream);
+}
+
+void SaxViewParser::on_start_element_view(std::string_view name, const AttributeViewList& attributes)
+{
+  AttributeList attribute_list;
+  for (const auto& attribute : attributes)
+    attribute_list.emplace_back(ustring(attribute.name), ustring(attribute.value));
+
+  on_start_element(ustring(name), attribute_list);
+}
+
+void SaxViewParser::on_end_element_view(std::string_view name)
+{
+  on_end_element(ustring(name));
+}
+
+void SaxViewParser::on_characters_view(std::string_view characters)
+{
+  on_characters(ustring(characters));
+}
+
+void SaxViewParser::on_comment_view(std::string_view text)
+{
+  on_comment(ustring(text));
+}
+
+void SaxViewParser::on_cdata_block_view(std::string_view text)
+{
+  on_cdata_block(ustring(text));
+}
+
+void SaxViewParser::on_processing_instruction(std::string_view /* target */, std::string_view /* data */)
+{
+}
+
+void SaxViewParser::on_start_element_ns(const QName& name, const NsAttributeList& attributes,
+  const NamespaceList& namespaces)
+{
+  start_element_sax1(name, attributes, namespaces);
+}
+
+void SaxViewParser::on_end_element_ns(const QName& name)
+{
+  end_element_sax1(name);
+}
+
+void SaxViewParser::on_pattern_match(std::size_t /* pattern_index */, const QName& /* name */,
+  const NsAttributeList& /* attributes */)
+{
+}
+
+} // namespace xmlpp
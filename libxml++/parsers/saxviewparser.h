@@ -0,0 +1,237 @@
+/* saxviewparser.h
+ * libxml++ and this file are
+ * copyright (C) 2026 by The libxml++ Development Team, and
+ * are covered by the GNU Lesser General Public License, which should be
+ * included with libxml++ as the file COPYING.
+ */
+
+#ifndef __LIBXMLPP_PARSERS_SAXVIEWPARSER_H
+#define __LIBXMLPP_PARSERS_SAXVIEWPARSER_H
+
+#include <libxml++/parsers/saxparser.h>
+
+#include <cstddef> // std::size_t
+#include <memory>
+#include <string_view>
+
+namespace xmlpp {
+
+class XPathPattern;
+
+/** SAX XML parser with callbacks that don't copy the parsed data.
+ *
+ * Derive your own class and override the on_*_view() methods, in addition
+ * to or instead of the on_*() methods of SaxParser. The on_*_view() methods
+ * receive std::string_view names and text, and an AttributeViewList, that
+ * point directly into libxml2's buffers.
+ *
+ * The namespace-aware methods on_start_element_ns() and on_end_element_ns()
+ * receive names that are split by the parser and interned in a dictionary,
+ * so they can be compared by pointer with names from intern().
+ *
+ * The elements can also be matched against XPath patterns while they are
+ * parsed. See add_pattern().
+ *
+ * The callbacks are in this class, and not in SaxParser, so that the virtual
+ * methods of SaxParser and of classes derived from it are not changed.
+ *
+ * @newin{5,8}
+ */
+class SaxViewParser : public SaxParser
+{
+public:
+  /**
+   * @param use_get_entity Set this to true if you will override on_get_entity().
+   * See SaxParser::SaxParser().
+   */
+  LIBXMLPP_API
+  explicit SaxViewParser(bool use_get_entity = false);
+  LIBXMLPP_API
+  ~SaxViewParser() override;
+
+  /** Set whether the parser will call the on_*_view() methods.
+   *
+   * No strings are copied. The default implementations of the on_*_view()
+   * methods call the corresponding methods that take xmlpp::ustring,
+   * such as on_start_element(), so a derived parser may override just the
+   * on_*_view() methods where the copying matters.
+   *
+   * By default the on_*_view() methods are not called. Call this method
+   * before the parse starts. Changing the setting during a chunk-wise
+   * parse does not take effect until the next parse.
+   *
+   * @param val Whether the on_*_view() methods shall be called.
+   */
+  LIBXMLPP_API
+  void set_string_view_callbacks(bool val = true) noexcept;
+
+  /** See set_string_view_callbacks().
+   *
+   * @returns Whether the on_*_view() methods will be called.
+   */
+  LIBXMLPP_API
+  bool get_string_view_callbacks() const noexcept;
+
+  /** Set whether the parser will call the namespace-aware methods.
+   *
+   * If set, on_start_element_ns() and on_end_element_ns() are called instead
+   * of on_start_element() and on_end_element(), and of
+   * on_start_element_view() and on_end_element_view(). The names are split
+   * into local name, prefix and namespace URI by the parser. Names that have
+   * been interned with intern() before the parse are passed as the same
+   * InternedName, so they can be compared without comparing strings.
+   *
+   * The default implementations of on_start_element_ns() and
+   * on_end_element_ns() rebuild the prefixed names and call the
+   * non-namespace-aware methods. Namespace declarations are then included
+   * among the attributes, as they are when this setting is off.
+   *
+   * By default the namespace-aware methods are not called. Call this method
+   * before the parse starts.
+   *
+   * @param val Whether the namespace-aware methods shall be called.
+   */
+  LIBXMLPP_API
+  void set_namespace_callbacks(bool val = true) noexcept;
+
+  /** See set_namespace_callbacks().
+   *
+   * @returns Whether the namespace-aware methods will be called.
+   */
+  LIBXMLPP_API
+  bool get_namespace_callbacks() const noexcept;
+
+  /** Intern a string in this parser's dictionary.
+   *
+   * The result compares equal to the names with the same contents that are
+   * passed to on_start_element_ns() and on_end_element_ns() in the following
+   * parses. It remains valid as long as this SaxViewParser exists.
+   *
+   * Intern the names before the parse starts. Other names that the parser
+   * finds are kept in a dictionary of their own, which is freed when the
+   * parse is done, so the memory used by the dictionaries does not grow
+   * from one parse to the next. Those names are valid until the parse ends.
+   *
+   * @param str The string to intern.
+   * @returns The interned string.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  InternedName intern(std::string_view str);
+
+  /** Add a pattern to match against the elements while parsing.
+   *
+   * on_pattern_match() is called for each element that matches the pattern,
+   * before the callback for the start of the element. The document is not
+   * built, and the memory used by the matching does not grow with the size
+   * of the document.
+   *
+   * While patterns are added, the parser uses libxml2's namespace-aware
+   * interface, but the callbacks that are called for the elements are
+   * unchanged. Call this method before the parse starts. The pattern must
+   * not be deleted while it's used by this parser.
+   *
+   * @param pattern The pattern.
+   * @returns The index of the pattern, passed to on_pattern_match().
+   */
+  LIBXMLPP_API
+  std::size_t add_pattern(const XPathPattern& pattern);
+
+  /** Remove all patterns that have been added with add_pattern().
+   */
+  LIBXMLPP_API
+  void clear_patterns() noexcept;
+
+protected:
+  /** Called instead of on_start_element(), if set_string_view_callbacks() is true.
+   * The default implementation copies the data and calls on_start_element().
+   *
+   * @param name The element's name, valid only during the call.
+   * @param attributes The element's attributes, valid only during the call.
+   */
+  LIBXMLPP_API
+  virtual void on_start_element_view(std::string_view name, const AttributeViewList& attributes);
+
+  /** Called instead of on_end_element(), if set_string_view_callbacks() is true.
+   * The default implementation calls on_end_element().
+   */
+  LIBXMLPP_API
+  virtual void on_end_element_view(std::string_view name);
+
+  /** Called instead of on_characters(), if set_string_view_callbacks() is true.
+   * The default implementation calls on_characters().
+   */
+  LIBXMLPP_API
+  virtual void on_characters_view(std::string_view characters);
+
+  /** Called instead of on_comment(), if set_string_view_callbacks() is true.
+   * The default implementation calls on_comment().
+   */
+  LIBXMLPP_API
+  virtual void on_comment_view(std::string_view text);
+
+  /** Called instead of on_cdata_block(), if set_string_view_callbacks() is true.
+   * The default implementation calls on_cdata_block().
+   */
+  LIBXMLPP_API
+  virtual void on_cdata_block_view(std::string_view text);
+
+  /** Called for each processing instruction.
+   * The default implementation does nothing.
+   *
+   * @param target The target of the processing instruction, valid only during the call.
+   * @param data The rest of the processing instruction, valid only during the call.
+   */
+  LIBXMLPP_API
+  virtual void on_processing_instruction(std::string_view target, std::string_view data);
+
+  /** Called instead of on_start_element(), if set_namespace_callbacks() is true.
+   * The default implementation rebuilds the prefixed names and calls
+   * on_start_element_view() or on_start_element().
+   *
+   * @param name The element's name.
+   * @param attributes The element's attributes, valid only during the call.
+   * @param namespaces The namespaces declared in the element, valid only during the call.
+   */
+  LIBXMLPP_API
+  virtual void on_start_element_ns(const QName& name, const NsAttributeList& attributes,
+    const NamespaceList& namespaces);
+
+  /** Called instead of on_end_element(), if set_namespace_callbacks() is true.
+   * The default implementation rebuilds the prefixed name and calls
+   * on_end_element_view() or on_end_element().
+   */
+  LIBXMLPP_API
+  virtual void on_end_element_ns(const QName& name);
+
+  /** Called when an element matches a pattern added with add_pattern().
+   * It's called before the callback for the start of the element, once for
+   * each matching pattern.
+   * The default implementation does nothing.
+   *
+   * @param pattern_index The index of the pattern, as returned by add_pattern().
+   * @param name The element's name.
+   * @param attributes The element's attributes, valid only during the call.
+   */
+  LIBXMLPP_API
+  virtual void on_pattern_match(std::size_t pattern_index, const QName& name,
+    const NsAttributeList& attributes);
+
+  LIBXMLPP_API
+  void initialize_context() override;
+
+private:
+  // Called by the SAX2 callbacks, if patterns have been added.
+  void match_patterns(const QName& name, const NsAttributeList& attributes);
+  void pop_patterns() noexcept;
+
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+
+  friend class SaxParser;
+  friend struct SaxParserCallback;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_PARSERS_SAXVIEWPARSER_H
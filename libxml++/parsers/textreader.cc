@@ -3,10 +3,16 @@
 #include <libxml++/exceptions/parse_error.h>
 #include <libxml++/exceptions/validity_error.h>
 #include <libxml++/document.h>
+#include <libxml++/io/mappedfile.h>
+#include <libxml++/xpathpattern.h>
+#include <libxml++/relaxngschema.h>
+#include <libxml++/xsdschema.h>
 
 #include <libxml/xmlreader.h>
 #include <libxml/xmlversion.h>
 
+#include <climits> // INT_MAX
+
 namespace
 {
 //TODO: When we can break ABI, change on_libxml_error(), and change ErrorFuncType to
@@ -32,6 +38,8 @@ static void c_callback_error(void* userData, xmlError* error)
   {
   case XML_FROM_VALID:
   case XML_FROM_DTD:
+  case XML_FROM_SCHEMASV:
+  case XML_FROM_RELAXNGV:
     severity = (error->level == XML_ERR_WARNING) ?
       XML_PARSER_SEVERITY_VALIDITY_WARNING :
       XML_PARSER_SEVERITY_VALIDITY_ERROR;
@@ -45,6 +53,11 @@ static void c_callback_error(void* userData, xmlError* error)
   p_callback_error(userData, msg.c_str(), severity, nullptr);
 }
 
+static int c_mapped_file_read_callback(void* context, char* buffer, int len)
+{
+  return static_cast<xmlpp::MappedFile*>(context)->read(buffer, len);
+}
+
 } // extern "C"
 } // anonymous namespace
 
@@ -66,6 +79,10 @@ public:
   std::optional<ustring> OptString(xmlChar* value);
 
   TextReader & owner_;
+
+  // A file parsed with TextReader(MappedFile&&). Stored here, instead of
+  // in TextReader, to keep TextReader's ABI.
+  std::unique_ptr<MappedFile> mapped_file_;
 };
 
 TextReader::TextReader(
@@ -105,6 +122,34 @@ TextReader::TextReader(
   setup_exceptions();
 }
 
+TextReader::TextReader(MappedFile&& file)
+  : propertyreader(new PropertyReader(*this)), impl_(nullptr), severity_(0)
+{
+  propertyreader->mapped_file_ = std::make_unique<MappedFile>(std::move(file));
+  auto& mapped_file = *propertyreader->mapped_file_;
+  const auto& uri = mapped_file.get_filename();
+
+#if LIBXML_VERSION >= 21300
+  // Memory input is parsed in place, without copying.
+  // libxml2 can't parse more than INT_MAX bytes from memory in one piece.
+  if (mapped_file.size() > 0 && mapped_file.size() <= INT_MAX)
+    impl_ = xmlReaderForMemory((const char*)mapped_file.data(),
+      static_cast<int>(mapped_file.size()), uri.c_str(), nullptr, 0);
+  else
+#endif
+    // Older libxml2 versions copy all of a memory input into a buffer.
+    // See Parser::create_mapped_file_context().
+    impl_ = xmlReaderForIO(c_mapped_file_read_callback, nullptr, &mapped_file,
+      uri.c_str(), nullptr, 0);
+
+  if( ! impl_ )
+  {
+    throw internal_error("Cannot instantiate underlying libxml2 structure");
+  }
+
+  setup_exceptions();
+}
+
 TextReader::~TextReader()
 {
   xmlFreeTextReader(impl_);
@@ -476,6 +521,46 @@ bool TextReader::is_valid() const
       xmlTextReaderIsValid(impl_));
 }
 
+bool TextReader::matches(const XPathPattern& pattern) const
+{
+  if (xmlTextReaderNodeType(impl_) != XML_READER_TYPE_ELEMENT)
+    return false;
+  return pattern.matches(NodeRef(xmlTextReaderCurrentNode(impl_)));
+}
+
+bool TextReader::read_to_match(const XPathPattern& pattern)
+{
+  while (read())
+    if (matches(pattern))
+      return true;
+  return false;
+}
+
+void TextReader::set_schema(const XsdSchema* schema)
+{
+  // libxml2 plugs a validation context into the reader's parser context.
+  // It relays the validity errors to the reader's error handler.
+  const auto cschema = schema ? const_cast<XsdSchema*>(schema)->cobj() : nullptr;
+  if (xmlTextReaderSetSchema(impl_, cschema) != 0)
+    throw internal_error("TextReader::set_schema(): Could not set the schema. "
+      "It must be set before the first read().");
+}
+
+void TextReader::set_schema(const RelaxNGSchema* schema)
+{
+  const auto cschema = schema ? const_cast<RelaxNGSchema*>(schema)->cobj() : nullptr;
+  if (xmlTextReaderRelaxNGSetSchema(impl_, cschema) != 0)
+    throw internal_error("TextReader::set_schema(): Could not set the schema. "
+      "It must be set before the first read().");
+}
+
+void TextReader::set_schema(std::nullptr_t)
+{
+  if (xmlTextReaderSetSchema(impl_, nullptr) != 0 ||
+      xmlTextReaderRelaxNGSetSchema(impl_, nullptr) != 0)
+    throw internal_error("TextReader::set_schema(): Could not remove the schema.");
+}
+
 void TextReader::setup_exceptions()
 {
   p_callback_error = &on_libxml_error;
@@ -533,7 +618,16 @@ char TextReader::PropertyReader::Char(int value)
 
 ustring TextReader::PropertyReader::String(xmlChar* value, bool should_free)
 {
-  owner_.check_for_exceptions();
+  try
+  {
+    owner_.check_for_exceptions();
+  }
+  catch (...)
+  {
+    if (should_free)
+      xmlFree(value);
+    throw;
+  }
 
   if (!value)
     return ustring();
@@ -558,7 +652,15 @@ ustring TextReader::PropertyReader::String(xmlChar const* value)
 
 std::optional<ustring> TextReader::PropertyReader::OptString(xmlChar* value)
 {
-  owner_.check_for_exceptions();
+  try
+  {
+    owner_.check_for_exceptions();
+  }
+  catch (...)
+  {
+    xmlFree(value);
+    throw;
+  }
 
   if (!value)
     return {};
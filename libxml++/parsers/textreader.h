@@ -9,9 +9,11 @@
 
 #include <libxml++/noncopyable.h>
 #include <libxml++/nodes/node.h>
+#include <libxml++/io/mappedfile.h>
 
 #include "libxml++/ustring.h"
 
+#include <cstddef> // std::nullptr_t
 #include <memory>
 #include <optional>
 
@@ -24,6 +26,9 @@ extern "C"
 // and rename all xyz2() to xyz().
 namespace xmlpp
 {
+class XPathPattern;
+class RelaxNGSchema;
+class XsdSchema;
 
 /** A TextReader-style XML parser.
  * A reader that provides fast, non-cached, forward-only access to XML data,
@@ -109,6 +114,19 @@ class TextReader: public NonCopyable
     LIBXMLPP_API
     TextReader(const unsigned char* data, size_type size, const ustring& uri = ustring());
 
+    /**
+     * Creates a new TextReader object which parses a memory-mapped file.
+     * The file is parsed directly from the operating system's page cache.
+     * The TextReader takes ownership of the mapping.
+     *
+     * @newin{5,8}
+     *
+     * @param file The mapped file. Its filename is used as the base URI of the document.
+     * @throws xmlpp::internal_error If an xmlTextReader object cannot be created.
+     */
+    LIBXMLPP_API
+    explicit TextReader(MappedFile&& file);
+
     LIBXMLPP_API ~TextReader() override;
 
     /** Moves the position of the current instance to the next node in the stream, exposing its properties.
@@ -495,6 +513,79 @@ class TextReader: public NonCopyable
     LIBXMLPP_API bool next();
     LIBXMLPP_API bool is_valid() const;
 
+    /** Find out if the current node is an element that matches a pattern.
+     * @newin{5,8}
+     * @param pattern The pattern.
+     * @returns Whether the current node is the start of a matching element.
+     */
+    LIBXMLPP_API bool matches(const XPathPattern& pattern) const;
+
+    /** Read until the start of an element that matches a pattern.
+     * The reader only keeps the current node and its ancestors, so a large
+     * document can be searched in constant memory:
+     * @code
+     * const xmlpp::XPathPattern pattern("/feed/entry/id");
+     * while (reader.read_to_match(pattern))
+     *   std::cout << reader.read_string2().value_or("") << std::endl;
+     * @endcode
+     * @newin{5,8}
+     * @param pattern The pattern.
+     * @return true if a matching element was read, false if there are no more nodes to read.
+     * @throws xmlpp::parse_error
+     * @throws xmlpp::validity_error
+     */
+    LIBXMLPP_API bool read_to_match(const XPathPattern& pattern);
+
+    /** Validate the document against an XSD schema while it's read.
+     * The document is validated node by node as the reader advances, without
+     * building more of the tree than the reader keeps anyway. Validity errors
+     * are reported like DTD validity errors: they are thrown as validity_error
+     * exceptions from methods that check for errors, and is_valid() returns
+     * false after the first error.
+     *
+     * Call this before the first read(). The schema must not be deleted
+     * while it's used by this reader.
+     * @newin{5,8}
+     * @param schema The schema, or <tt>nullptr</tt> to stop validating.
+     * @throws xmlpp::internal_error If reading has already started.
+     */
+    LIBXMLPP_API void set_schema(const XsdSchema* schema);
+
+    /** Validate the document against a RelaxNG schema while it's read.
+     * The document is validated node by node as the reader advances.
+     * is_valid() tells if the nodes that have been read so far are valid,
+     * so reading can stop at the first violation, without reading the rest
+     * of a large document:
+     * @code
+     * reader.set_schema(&schema);
+     * while (reader.read() && reader.is_valid())
+     *   process(reader);
+     * @endcode
+     * Validity errors are thrown as validity_error exceptions from methods
+     * that check for errors, like with set_schema(const XsdSchema*).
+     * Some patterns in a RelaxNG schema can be checked only on a complete
+     * element. Such an element is expanded in memory while it's validated.
+     *
+     * Call this before the first read(). The schema must not be deleted
+     * while it's used by this reader.
+     * @newin{5,8}
+     * @param schema The schema, or <tt>nullptr</tt> to stop validating.
+     * @throws xmlpp::internal_error If reading has already started.
+     */
+    LIBXMLPP_API void set_schema(const RelaxNGSchema* schema);
+
+    /** Stop validating the document against a schema.
+     * Removes a schema that has been set with set_schema(const XsdSchema*)
+     * or set_schema(const RelaxNGSchema*), so that <tt>set_schema(nullptr)</tt>
+     * is not ambiguous.
+     *
+     * Unlike setting a schema, this can also be done while reading. The rest
+     * of the document is then not validated.
+     * @newin{5,8}
+     * @throws xmlpp::internal_error
+     */
+    LIBXMLPP_API void set_schema(std::nullptr_t);
+
   private:
     class PropertyReader;
     friend class PropertyReader;
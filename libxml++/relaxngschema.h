@@ -38,6 +38,9 @@ namespace xmlpp
 /** Represents a RelaxNG schema for validating XML files.
  * RelaxNG = REgular LAnguage for XML Next Generation
  *
+ * A parsed schema is not modified by validation. It can be shared by several
+ * threads through a <tt>std::shared_ptr<const RelaxNGSchema></tt>, see SharedSchemaValidator.
+ *
  * @newin{2,38}
  */
 class RelaxNGSchema : public SchemaBase
@@ -0,0 +1,129 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "libxml++/validators/batchvalidator.h"
+#include "libxml++/validators/sharedschemavalidator.h"
+#include "libxml++/exceptions/parse_error.h"
+#include "libxml++/exceptions/validity_error.h"
+
+#include <exception>
+
+namespace
+{
+// Run a validation, and convert its exception, if any, to a result.
+template <typename F>
+void get_result(xmlpp::BatchValidator::Result& result, F validate) noexcept
+{
+  using Status = xmlpp::BatchValidator::Result::Status;
+  try
+  {
+    try
+    {
+      validate();
+      result.status = Status::VALID;
+    }
+    catch (const xmlpp::validity_error& ex)
+    {
+      result.status = Status::INVALID;
+      result.message = ex.what();
+    }
+    catch (const xmlpp::parse_error& ex)
+    {
+      result.status = Status::PARSE_ERROR;
+      result.message = ex.what();
+    }
+    catch (const std::exception& ex)
+    {
+      result.status = Status::OTHER_ERROR;
+      result.message = ex.what();
+    }
+    catch (...)
+    {
+      result.status = Status::OTHER_ERROR;
+      result.message = "An exception was thrown that is not derived from std::exception.";
+    }
+  }
+  catch (...)
+  {
+    // The message could not be copied. The status has been set.
+  }
+}
+} // anonymous namespace
+
+namespace xmlpp
+{
+
+struct BatchValidator::Impl
+{
+  template <typename Schema>
+  explicit Impl(std::shared_ptr<const Schema> schema)
+  : validator(std::move(schema))
+  {}
+
+  SharedSchemaValidator validator;
+};
+
+BatchValidator::BatchValidator(std::shared_ptr<const XsdSchema> schema, unsigned int n_threads)
+: ParserPoolBase(n_threads), pimpl_(new Impl(std::move(schema)))
+{
+}
+
+BatchValidator::BatchValidator(std::shared_ptr<const RelaxNGSchema> schema, unsigned int n_threads)
+: ParserPoolBase(n_threads), pimpl_(new Impl(std::move(schema)))
+{
+}
+
+BatchValidator::BatchValidator(std::shared_ptr<const Dtd> dtd, unsigned int n_threads)
+: ParserPoolBase(n_threads), pimpl_(new Impl(std::move(dtd)))
+{
+}
+
+BatchValidator::~BatchValidator()
+{
+}
+
+std::vector<BatchValidator::Result> BatchValidator::validate_files(
+  const std::vector<std::string>& filenames)
+{
+  std::vector<Result> results(filenames.size());
+  const auto& validator = pimpl_->validator;
+  run_batch(filenames.size(), [&](unsigned int /* slot */, std::size_t index)
+  {
+    get_result(results[index], [&] { validator.validate(filenames[index]); });
+  });
+  return results;
+}
+
+std::vector<BatchValidator::Result> BatchValidator::validate_memory(
+  const std::vector<std::string_view>& documents)
+{
+  std::vector<Result> results(documents.size());
+  const auto& validator = pimpl_->validator;
+  run_batch(documents.size(), [&](unsigned int /* slot */, std::size_t index)
+  {
+    get_result(results[index], [&] { validator.validate_memory(documents[index]); });
+  });
+  return results;
+}
+
+const SharedSchemaValidator& BatchValidator::get_validator() const noexcept
+{
+  return pimpl_->validator;
+}
+
+} // namespace xmlpp
@@ -0,0 +1,160 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_VALIDATOR_BATCHVALIDATOR_H
+#define __LIBXMLPP_VALIDATOR_BATCHVALIDATOR_H
+
+#include <libxml++/parsers/parserpool.h>
+#include <libxml++/ustring.h>
+
+#include <memory> // std::shared_ptr, std::unique_ptr
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xmlpp
+{
+class Dtd;
+class RelaxNGSchema;
+class SharedSchemaValidator;
+class XsdSchema;
+
+/** Validates collections of documents on several threads.
+ *
+ * All documents are validated against one schema or DTD, which is parsed and
+ * compiled once, with a SharedSchemaValidator. The documents of a batch are
+ * spread over the threads of the pool. Each thread takes the next document
+ * when it's done with the previous one, so a few large documents don't keep
+ * the other threads waiting. The threads are started by the first batch, and
+ * kept until the BatchValidator is destroyed.
+ *
+ * Each document gets a Result. A batch does not stop at the first invalid
+ * document:
+ * @code
+ * xmlpp::BatchValidator validator(std::make_shared<const xmlpp::XsdSchema>("schema.xsd"));
+ * const auto results = validator.validate_files(filenames);
+ * for (std::size_t i = 0; i < results.size(); ++i)
+ *   if (!results[i])
+ *     std::cerr << filenames[i] << ": " << results[i].message << std::endl;
+ * @endcode
+ *
+ * @newin{5,8}
+ */
+class BatchValidator : public ParserPoolBase
+{
+public:
+  /// The outcome of the validation of one document.
+  struct Result
+  {
+    enum class Status
+    {
+      VALID,       ///< The document is valid.
+      INVALID,     ///< The document is well-formed, but not valid.
+      PARSE_ERROR, ///< The document could not be read, or is not well-formed.
+      OTHER_ERROR  ///< Some other error, such as lack of memory.
+    };
+
+    Status status = Status::VALID;
+
+    /// The error messages, or an empty string if the document is valid.
+    ustring message;
+
+    /// Whether the document is valid.
+    explicit operator bool() const noexcept { return status == Status::VALID; }
+  };
+
+  /** Create a validator that validates against an XSD schema.
+   * XML files and documents in memory are validated while they are parsed,
+   * without building a tree.
+   * @param schema A parsed schema.
+   * @param n_threads The number of threads, including the thread that runs
+   *        a batch. 0 means std::thread::hardware_concurrency().
+   * @throws xmlpp::internal_error If the schema has not been parsed.
+   */
+  LIBXMLPP_API
+  explicit BatchValidator(std::shared_ptr<const XsdSchema> schema, unsigned int n_threads = 0);
+
+  /** Create a validator that validates against a RelaxNG schema.
+   * @param schema A parsed schema.
+   * @param n_threads The number of threads, including the thread that runs
+   *        a batch. 0 means std::thread::hardware_concurrency().
+   * @throws xmlpp::internal_error If the schema has not been parsed.
+   */
+  LIBXMLPP_API
+  explicit BatchValidator(std::shared_ptr<const RelaxNGSchema> schema, unsigned int n_threads = 0);
+
+  /** Create a validator that validates against a DTD.
+   * @param dtd A parsed DTD.
+   * @param n_threads The number of threads, including the thread that runs
+   *        a batch. 0 means std::thread::hardware_concurrency().
+   * @throws xmlpp::internal_error If the DTD has not been parsed.
+   * @throws xmlpp::parse_error If a content model can't be compiled.
+   */
+  LIBXMLPP_API
+  explicit BatchValidator(std::shared_ptr<const Dtd> dtd, unsigned int n_threads = 0);
+
+  LIBXMLPP_API
+  ~BatchValidator() override;
+
+  /** Validate XML files.
+   * Returns when all files have been validated.
+   * @param filenames The URLs of the files.
+   * @returns A result for each file, in the same order as @a filenames.
+   * @throws std::system_error If a thread can't be started.
+   */
+  LIBXMLPP_API
+  std::vector<Result> validate_files(const std::vector<std::string>& filenames);
+
+  /** Validate XML documents in memory.
+   * Returns when all documents have been validated.
+   * @param documents The documents.
+   * @returns A result for each document, in the same order as @a documents.
+   * @throws std::system_error If a thread can't be started.
+   */
+  LIBXMLPP_API
+  std::vector<Result> validate_memory(const std::vector<std::string_view>& documents);
+
+  /** Validate XML documents in memory.
+   * @param documents A range of documents. Each element must be convertible
+   *        to std::string_view, such as std::string.
+   * @returns A result for each document, in the same order as @a documents.
+   * @throws std::system_error If a thread can't be started.
+   */
+  template <typename Range>
+  std::vector<Result> validate_memory(const Range& documents)
+  {
+    std::vector<std::string_view> views;
+    for (const auto& document : documents)
+      views.emplace_back(document);
+    return validate_memory(views);
+  }
+
+  /** Get the validator that validates the documents.
+   * It can also be used directly, by any thread.
+   */
+  LIBXMLPP_API
+  const SharedSchemaValidator& get_validator() const noexcept;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_VALIDATOR_BATCHVALIDATOR_H
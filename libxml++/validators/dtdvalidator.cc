@@ -7,7 +7,7 @@
 
 #include "libxml++/validators/dtdvalidator.h"
 #include "libxml++/dtd.h"
-#include "libxml++/nodes/node.h"
+#include "libxml++/nodes/element.h"
 #include "libxml++/exceptions/internal_error.h"
 #include "libxml++/exceptions/validity_error.h"
 #include "libxml++/io/istreamparserinputbuffer.h"
@@ -174,4 +174,43 @@ void DtdValidator::validate(const Document* document)
   }
 }
 
+void DtdValidator::validate(const Element* element)
+{
+  if (!element)
+    throw internal_error("Element pointer cannot be nullptr.");
+
+  auto node = const_cast<xmlNode*>(element->cobj());
+  if (!node->doc)
+    throw internal_error("The element must belong to a document.");
+
+  if (!pimpl_->dtd)
+    throw internal_error("No DTD to use for validation.");
+
+  // A context is required at this stage only
+  if (!pimpl_->context)
+    pimpl_->context = xmlNewValidCtxt();
+
+  if (!pimpl_->context)
+    throw internal_error("Couldn't create validation context");
+
+  xmlResetLastError();
+  initialize_context();
+
+  // Use the DTD instead of the document's own DTD, like xmlValidateDtd().
+  auto doc = node->doc;
+  const auto old_int_subset = doc->intSubset;
+  const auto old_ext_subset = doc->extSubset;
+  doc->intSubset = nullptr;
+  doc->extSubset = pimpl_->dtd->cobj();
+  const auto res = (bool)xmlValidateElement(pimpl_->context, doc, node);
+  doc->intSubset = old_int_subset;
+  doc->extSubset = old_ext_subset;
+
+  if (!res)
+  {
+    check_for_exception();
+    throw validity_error("Element failed DTD validation\n" + format_xml_error());
+  }
+}
+
 } // namespace xmlpp
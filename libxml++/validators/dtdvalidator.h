@@ -133,6 +133,22 @@ public:
   LIBXMLPP_API
   void validate(const Document* document) override;
 
+  /** Validate an element and its descendants, using a previously parsed DTD.
+   * Only the subtree is visited, so after a part of a large document has been
+   * changed, the changed part can be validated without the rest of the document.
+   *
+   * Like in validate(const Document*), the document's own DTD is not used.
+   * IDREF attributes are not checked, because that requires the IDs of the
+   * whole document.
+   * @param element Pointer to the element. It must belong to a document.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::validity_error
+   *
+   * @newin{5,8}
+   */
+  LIBXMLPP_API
+  void validate(const Element* element);
+
 protected:
   LIBXMLPP_API
   void initialize_context() override;
@@ -0,0 +1,413 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "libxml++/validators/sharedschemavalidator.h"
+#include "libxml++/document.h"
+#include "libxml++/dtd.h"
+#include "libxml++/relaxngschema.h"
+#include "libxml++/xsdschema.h"
+#include "libxml++/exceptions/internal_error.h"
+#include "libxml++/exceptions/parse_error.h"
+#include "libxml++/exceptions/validity_error.h"
+
+#include <libxml/parser.h>
+#include <libxml/relaxng.h>
+#include <libxml/valid.h>
+#include <libxml/xmlschemas.h>
+
+#include <climits> // INT_MAX
+#include <cstdarg> // va_list
+#include <mutex>
+#include <vector>
+
+namespace
+{
+// A validation context, used by one thread at a time.
+struct ValidationContext
+{
+  ValidationContext() = default;
+  ValidationContext(const ValidationContext&) = delete;
+  ValidationContext& operator=(const ValidationContext&) = delete;
+
+  ~ValidationContext()
+  {
+    if (xsd)
+      xmlSchemaFreeValidCtxt(xsd);
+    if (relaxng)
+      xmlRelaxNGFreeValidCtxt(relaxng);
+    if (dtd)
+      xmlFreeValidCtxt(dtd);
+    if (parser)
+      xmlFreeParserCtxt(parser);
+  }
+
+  // One of these, depending on the kind of schema.
+  xmlSchemaValidCtxtPtr xsd = nullptr;
+  xmlRelaxNGValidCtxtPtr relaxng = nullptr;
+  xmlValidCtxtPtr dtd = nullptr;
+
+  // Parses files that are not validated while they're parsed.
+  // Created on demand, and reused.
+  xmlParserCtxtPtr parser = nullptr;
+
+  // The messages of the current validation.
+  xmlpp::ustring messages;
+};
+
+extern "C"
+{
+#if LIBXML_VERSION >= 21200
+static void c_structured_error(void* userData, const xmlError* error)
+#else
+static void c_structured_error(void* userData, xmlError* error)
+#endif
+{
+  auto context = static_cast<ValidationContext*>(userData);
+  try
+  {
+    context->messages += xmlpp::format_xml_error(error);
+  }
+  catch (...)
+  {
+    // Out of memory. The message is lost, but the validation result is not.
+  }
+}
+
+static void c_dtd_error(void* ctx, const char* msg, ...)
+{
+  auto context = static_cast<ValidationContext*>(ctx);
+  va_list var_args;
+  va_start(var_args, msg);
+  try
+  {
+    context->messages += xmlpp::format_printf_message(msg, var_args);
+  }
+  catch (...)
+  {
+  }
+  va_end(var_args);
+}
+
+#if LIBXML_VERSION >= 21200
+static void c_ignore_error(void*, const xmlError*)
+#else
+static void c_ignore_error(void*, xmlError*)
+#endif
+{
+  // The parser context keeps the last error.
+}
+} // extern "C"
+} // anonymous namespace
+
+namespace xmlpp
+{
+
+struct SharedSchemaValidator::Impl
+{
+  // Gives a context back to the pool on destruction.
+  class Lease
+  {
+  public:
+    Lease(const Impl& impl, std::unique_ptr<ValidationContext> context) noexcept
+    : impl_(impl), context_(std::move(context))
+    {}
+
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+
+    ~Lease()
+    {
+      impl_.give_back(std::move(context_));
+    }
+
+    ValidationContext& operator*() const noexcept { return *context_; }
+    ValidationContext* operator->() const noexcept { return context_.get(); }
+
+  private:
+    const Impl& impl_;
+    std::unique_ptr<ValidationContext> context_;
+  };
+
+  Lease acquire() const
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_contexts_.empty())
+      {
+        auto context = std::move(free_contexts_.back());
+        free_contexts_.pop_back();
+        return Lease(*this, std::move(context));
+      }
+    }
+    auto context = create_context();
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++n_contexts_;
+    return Lease(*this, std::move(context));
+  }
+
+  void give_back(std::unique_ptr<ValidationContext> context) const noexcept
+  {
+    try
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_contexts_.push_back(std::move(context));
+    }
+    catch (...)
+    {
+      // Out of memory. The context is deleted instead.
+    }
+  }
+
+  std::unique_ptr<ValidationContext> create_context() const
+  {
+    auto context = std::make_unique<ValidationContext>();
+    if (xsd_schema_)
+    {
+      context->xsd = xmlSchemaNewValidCtxt(const_cast<xmlSchema*>(xsd_schema_->cobj()));
+      if (!context->xsd)
+        throw internal_error("SharedSchemaValidator: Could not create validating context");
+      xmlSchemaSetValidStructuredErrors(context->xsd, c_structured_error, context.get());
+    }
+    else if (relaxng_schema_)
+    {
+      context->relaxng = xmlRelaxNGNewValidCtxt(const_cast<xmlRelaxNG*>(relaxng_schema_->cobj()));
+      if (!context->relaxng)
+        throw internal_error("SharedSchemaValidator: Could not create validating context");
+      xmlRelaxNGSetValidStructuredErrors(context->relaxng, c_structured_error, context.get());
+    }
+    else
+    {
+      context->dtd = xmlNewValidCtxt();
+      if (!context->dtd)
+        throw internal_error("SharedSchemaValidator: Could not create validating context");
+      context->dtd->userData = context.get();
+      context->dtd->error = c_dtd_error;
+      context->dtd->warning = c_dtd_error;
+    }
+    return context;
+  }
+
+  // The parser context, for a schema that can't validate while parsing.
+  static xmlParserCtxt* get_parser(ValidationContext& context)
+  {
+    if (!context.parser)
+    {
+      context.parser = xmlNewParserCtxt();
+      if (!context.parser)
+        throw internal_error("SharedSchemaValidator: Could not create parser context");
+      // Don't print the errors. format_xml_parser_error() reads them from the context.
+      context.parser->sax->serror = c_ignore_error;
+    }
+    return context.parser;
+  }
+
+  // Take ownership of a document from xmlCtxtRead*().
+  static std::unique_ptr<xmlDoc, void(*)(xmlDoc*)> check_parsed(
+    const ValidationContext& context, xmlDoc* doc)
+  {
+    if (!doc)
+    {
+      auto error_str = format_xml_parser_error(context.parser);
+      if (error_str.empty())
+        error_str = "Could not parse the document.";
+      throw parse_error(error_str);
+    }
+    return std::unique_ptr<xmlDoc, void(*)(xmlDoc*)>(doc, xmlFreeDoc);
+  }
+
+  // Check the result of xmlSchemaValidateFile() or xmlSchemaValidateStream().
+  // filename is empty, unless a file was validated.
+  static void check_stream_result(const ValidationContext& context, int res,
+    const std::string& function, const std::string& filename = std::string())
+  {
+    if (res < 0)
+    {
+      // The document could not be read or is not well-formed.
+      // libxml2 does not report an error if the file can't be opened.
+      auto error_str = format_xml_error();
+      if (error_str.empty())
+      {
+        error_str = "Error code from " + function + ": " + std::to_string(res);
+        if (!filename.empty())
+          error_str = "Could not read file " + filename + ". " + error_str;
+      }
+      throw parse_error(error_str);
+    }
+    if (res > 0)
+    {
+      auto error_str = context.messages;
+      if (error_str.empty())
+        error_str = "Error code from " + function + ": " + std::to_string(res);
+      throw validity_error("Document failed XSD schema validation.\n" + error_str);
+    }
+  }
+
+  // Validate a document with a context that has been prepared for it.
+  void validate(ValidationContext& context, xmlDoc* doc) const
+  {
+    int res = 0;
+    std::string function;
+    std::string kind;
+    if (context.xsd)
+    {
+      res = xmlSchemaValidateDoc(context.xsd, doc);
+      function = "xmlSchemaValidateDoc()";
+      kind = "XSD schema";
+    }
+    else if (context.relaxng)
+    {
+      res = xmlRelaxNGValidateDoc(context.relaxng, doc);
+      function = "xmlRelaxNGValidateDoc()";
+      kind = "RelaxNG schema";
+    }
+    else
+    {
+      // xmlValidateDtd() returns 1 if valid, else 0.
+      res = !xmlValidateDtd(context.dtd, doc, const_cast<xmlDtd*>(dtd_->cobj()));
+      function = "xmlValidateDtd()";
+      kind = "DTD";
+    }
+
+    if (res != 0)
+    {
+      auto error_str = context.messages;
+      if (error_str.empty())
+        error_str = "Error code from " + function + ": " + std::to_string(res);
+      throw validity_error("Document failed " + kind + " validation.\n" + error_str);
+    }
+  }
+
+  // Keep the schema alive. Only one of these is set.
+  std::shared_ptr<const XsdSchema> xsd_schema_;
+  std::shared_ptr<const RelaxNGSchema> relaxng_schema_;
+  std::shared_ptr<const Dtd> dtd_;
+
+  mutable std::mutex mutex_;
+  mutable std::vector<std::unique_ptr<ValidationContext>> free_contexts_;
+  mutable std::size_t n_contexts_ = 0;
+};
+
+SharedSchemaValidator::SharedSchemaValidator(std::shared_ptr<const XsdSchema> schema)
+: pimpl_(new Impl)
+{
+  if (!(schema && schema->cobj()))
+    throw internal_error("SharedSchemaValidator: Must have a parsed schema.");
+  pimpl_->xsd_schema_ = std::move(schema);
+}
+
+SharedSchemaValidator::SharedSchemaValidator(std::shared_ptr<const RelaxNGSchema> schema)
+: pimpl_(new Impl)
+{
+  if (!(schema && schema->cobj()))
+    throw internal_error("SharedSchemaValidator: Must have a parsed schema.");
+  pimpl_->relaxng_schema_ = std::move(schema);
+}
+
+SharedSchemaValidator::SharedSchemaValidator(std::shared_ptr<const Dtd> dtd)
+: pimpl_(new Impl)
+{
+  if (!(dtd && dtd->cobj()))
+    throw internal_error("SharedSchemaValidator: Must have a parsed DTD.");
+  pimpl_->dtd_ = std::move(dtd);
+
+  // Compile the content models now. Otherwise xmlValidateDtd() compiles them
+  // when it first needs them, and threads would modify the DTD concurrently.
+  auto context = pimpl_->acquire();
+  auto cdtd = const_cast<xmlDtd*>(pimpl_->dtd_->cobj());
+  for (auto node = cdtd->children; node; node = node->next)
+  {
+    if (node->type != XML_ELEMENT_DECL)
+      continue;
+    auto element = reinterpret_cast<xmlElement*>(node);
+    if (element->etype == XML_ELEMENT_TYPE_ELEMENT && !element->contModel &&
+        !xmlValidBuildContentModel(context->dtd, element))
+      throw parse_error("SharedSchemaValidator: Could not compile a content model.\n" +
+        context->messages);
+  }
+}
+
+SharedSchemaValidator::~SharedSchemaValidator()
+{
+}
+
+void SharedSchemaValidator::validate(const Document* document) const
+{
+  if (!document)
+    throw internal_error("SharedSchemaValidator::validate(): document must not be nullptr.");
+
+  auto context = pimpl_->acquire();
+  context->messages.clear();
+  pimpl_->validate(*context, const_cast<xmlDoc*>(document->cobj()));
+}
+
+void SharedSchemaValidator::validate(const std::string& filename) const
+{
+  auto context = pimpl_->acquire();
+  context->messages.clear();
+
+  if (context->xsd)
+  {
+    // Validate while parsing, without building a document.
+    xmlResetLastError();
+    const int res = xmlSchemaValidateFile(context->xsd, filename.c_str(), 0);
+    Impl::check_stream_result(*context, res, "xmlSchemaValidateFile()", filename);
+    return;
+  }
+
+  auto parser = Impl::get_parser(*context);
+  auto doc = Impl::check_parsed(*context, xmlCtxtReadFile(parser, filename.c_str(), nullptr, 0));
+  pimpl_->validate(*context, doc.get());
+}
+
+void SharedSchemaValidator::validate_memory(std::string_view contents) const
+{
+  if (contents.size() > static_cast<std::size_t>(INT_MAX))
+    throw parse_error("Document is too large.");
+  const int size = static_cast<int>(contents.size());
+
+  auto context = pimpl_->acquire();
+  context->messages.clear();
+
+  if (context->xsd)
+  {
+    // Validate while parsing, without building a document.
+    // xmlSchemaValidateStream() frees the input buffer. The contents are
+    // copied, because libxml2 2.9 stops reading a static buffer too early.
+    xmlResetLastError();
+    auto input = xmlParserInputBufferCreateMem(contents.data(), size, XML_CHAR_ENCODING_NONE);
+    if (!input)
+      throw internal_error("SharedSchemaValidator: Could not create input buffer");
+    const int res = xmlSchemaValidateStream(context->xsd, input, XML_CHAR_ENCODING_NONE,
+      nullptr, nullptr);
+    Impl::check_stream_result(*context, res, "xmlSchemaValidateStream()");
+    return;
+  }
+
+  auto parser = Impl::get_parser(*context);
+  auto doc = Impl::check_parsed(*context,
+    xmlCtxtReadMemory(parser, contents.data(), size, nullptr, nullptr, 0));
+  pimpl_->validate(*context, doc.get());
+}
+
+std::size_t SharedSchemaValidator::get_n_contexts() const noexcept
+{
+  std::lock_guard<std::mutex> lock(pimpl_->mutex_);
+  return pimpl_->n_contexts_;
+}
+
+} // namespace xmlpp
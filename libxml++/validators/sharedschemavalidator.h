@@ -0,0 +1,136 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_VALIDATOR_SHAREDSCHEMAVALIDATOR_H
+#define __LIBXMLPP_VALIDATOR_SHAREDSCHEMAVALIDATOR_H
+
+#include <libxml++config.h>
+#include <libxml++/noncopyable.h>
+
+#include <memory> // std::shared_ptr, std::unique_ptr
+#include <string>
+#include <string_view>
+
+namespace xmlpp
+{
+class Document;
+class Dtd;
+class RelaxNGSchema;
+class XsdSchema;
+
+/** A validator that can be used by several threads at once.
+ *
+ * XsdValidator, RelaxNGValidator and DtdValidator each pair a schema or DTD
+ * with one validation context, and a validator can't be used by several
+ * threads at the same time. A SharedSchemaValidator shares one schema or DTD,
+ * which is parsed and compiled once, and keeps a pool of validation contexts.
+ * Each call to validate() borrows a context from the pool, and gives it back
+ * when it's done, so each thread soon has a context of its own, and the threads
+ * don't wait for each other while they validate:
+ * @code
+ * auto schema = std::make_shared<const xmlpp::XsdSchema>("schema.xsd");
+ * const xmlpp::SharedSchemaValidator validator(schema);
+ * // In any thread:
+ * validator.validate(document);
+ * @endcode
+ *
+ * The schema is not modified by validation, and is kept alive by the
+ * validator. It must not be changed, e.g. with XsdSchema::parse_file(), while
+ * the validator exists. Different threads must validate different documents.
+ *
+ * @newin{5,8}
+ */
+class SharedSchemaValidator : public NonCopyable
+{
+public:
+  /** Create a validator that validates against an XSD schema.
+   * @param schema A parsed schema.
+   * @throws xmlpp::internal_error If the schema has not been parsed.
+   */
+  LIBXMLPP_API
+  explicit SharedSchemaValidator(std::shared_ptr<const XsdSchema> schema);
+
+  /** Create a validator that validates against a RelaxNG schema.
+   * @param schema A parsed schema.
+   * @throws xmlpp::internal_error If the schema has not been parsed.
+   */
+  LIBXMLPP_API
+  explicit SharedSchemaValidator(std::shared_ptr<const RelaxNGSchema> schema);
+
+  /** Create a validator that validates against a DTD.
+   * libxml2 compiles the content models of a DTD's element declarations the
+   * first time they are needed. This constructor compiles them all, so that
+   * validation does not modify the DTD.
+   * @param dtd A parsed DTD.
+   * @throws xmlpp::internal_error If the DTD has not been parsed.
+   * @throws xmlpp::parse_error If a content model can't be compiled.
+   */
+  LIBXMLPP_API
+  explicit SharedSchemaValidator(std::shared_ptr<const Dtd> dtd);
+
+  LIBXMLPP_API
+  ~SharedSchemaValidator() override;
+
+  /** Validate a document.
+   * This method may be called by several threads at once.
+   * @param document Pointer to the document.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void validate(const Document* document) const;
+
+  /** Validate an XML file.
+   * With an XSD schema, the file is validated while it's parsed, without
+   * building a document. Otherwise the file is parsed into a temporary document.
+   * This method may be called by several threads at once.
+   * @param filename The URL of the XML file.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::parse_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void validate(const std::string& filename) const;
+
+  /** Validate an XML document in memory.
+   * With an XSD schema, the document is validated while it's parsed, without
+   * building a tree. Otherwise it's parsed into a temporary document.
+   * This method may be called by several threads at once.
+   * @param contents The XML document.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::parse_error
+   * @throws xmlpp::validity_error
+   */
+  LIBXMLPP_API
+  void validate_memory(std::string_view contents) const;
+
+  /** The number of validation contexts that have been created.
+   * It's at most the highest number of threads that have been validating
+   * at the same time.
+   */
+  LIBXMLPP_API
+  std::size_t get_n_contexts() const noexcept;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_VALIDATOR_SHAREDSCHEMAVALIDATOR_H
@@ -18,9 +18,13 @@
 
 #include "libxml++/validators/xsdvalidator.h"
 #include "libxml++/xsdschema.h"
+#include "libxml++/nodes/element.h"
 
+#include <libxml/parser.h>
 #include <libxml/xmlschemas.h>
 
+#include <utility> // std::move
+
 namespace xmlpp
 {
 
@@ -180,9 +184,87 @@ void XsdValidator::validate(const std::string& filename)
 
     auto error_str = format_xml_error();
     if (error_str.empty())
+    {
+      // libxml2 does not report an error if the file can't be opened.
       error_str = "Error code from xmlSchemaValidateFile(): " + std::to_string(res);
+      if (res < 0)
+        error_str = "Could not read file " + filename + ". " + error_str;
+    }
     throw validity_error("XML file failed XSD schema validation.\n" + error_str);
   }
 }
 
+void XsdValidator::validate(const Element* element)
+{
+  if (!element)
+    throw internal_error("XsdValidator::validate(): element must not be nullptr.");
+
+  if (!*this)
+    throw internal_error("XsdValidator::validate(): Must have a schema to validate element");
+
+  // A context is required at this stage only
+  if (!pimpl_->context)
+    pimpl_->context = xmlSchemaNewValidCtxt(pimpl_->schema->cobj());
+
+  if (!pimpl_->context)
+    throw internal_error("XsdValidator::validate(): Could not create validating context");
+
+  xmlResetLastError();
+  initialize_context();
+
+  const int res = xmlSchemaValidateOneElement(pimpl_->context, const_cast<xmlNode*>(element->cobj()));
+  if (res != 0)
+  {
+    check_for_exception();
+
+    auto error_str = format_xml_error();
+    if (error_str.empty())
+      error_str = "Error code from xmlSchemaValidateOneElement(): " + std::to_string(res);
+    throw validity_error("Element failed XSD schema validation.\n" + error_str);
+  }
+}
+
+_xmlSchemaSAXPlug* XsdValidator::plug(_xmlParserCtxt* parser_context)
+{
+  if (!*this)
+    throw internal_error("XsdValidator::plug(): Must have a schema to validate a stream.");
+
+  if (!pimpl_->context)
+    pimpl_->context = xmlSchemaNewValidCtxt(pimpl_->schema->cobj());
+
+  if (!pimpl_->context)
+    throw internal_error("XsdValidator::plug(): Could not create validating context");
+
+  initialize_context();
+
+  // The plug's SAX handler validates each event and forwards it to the
+  // parser's SAX handler, with the parser's user data.
+  auto plug = xmlSchemaSAXPlug(pimpl_->context, &parser_context->sax, &parser_context->userData);
+  if (!plug)
+    throw internal_error("XsdValidator::plug(): Could not plug the validator into the parser. "
+      "The parser must use the namespace-aware SAX2 callbacks.");
+  return plug;
+}
+
+void XsdValidator::check_stream_validity()
+{
+  // The messages are collected in validate_error_ and validate_warning_ by
+  // the callbacks that initialize_context() has set.
+  auto error_str = std::move(validate_error_);
+  validate_error_.erase();
+  validate_warning_.erase();
+
+  // An exception thrown by on_validity_error() or on_validity_warning().
+  check_for_exception();
+
+  if (xmlSchemaIsValid(pimpl_->context) != 1)
+  {
+    if (error_str.empty())
+      error_str = format_xml_error();
+    if (error_str.empty())
+      error_str = "xmlSchemaIsValid() returned false.";
+    throw validity_error("Document failed XSD schema validation.\n" + error_str);
+  }
+}
+
 } // namespace xmlpp
@@ -22,9 +22,18 @@
 #include <libxml++/validators/schemavalidatorbase.h>
 #include <memory> // std::unique_ptr
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlParserCtxt;
+  struct _xmlSchemaSAXPlug;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
 namespace xmlpp
 {
 class Document;
+class Element;
+class SaxParser;
 class XsdSchema;
 
 /** XSD schema validator.
@@ -145,6 +154,22 @@ public:
   LIBXMLPP_API
   void validate(const std::string& filename) override;
 
+  /** Validate an element and its descendants, using a previously parsed schema.
+   * Only the subtree is visited, so after a part of a large document has been
+   * changed, the changed part can be validated without the rest of the document.
+   *
+   * The element must match a global element declaration in the schema.
+   * Identity constraints (xs:unique, xs:key, xs:keyref) are checked only
+   * within the subtree.
+   * @param element Pointer to the element.
+   * @throws xmlpp::internal_error
+   * @throws xmlpp::validity_error
+   *
+   * @newin{5,8}
+   */
+  LIBXMLPP_API
+  void validate(const Element* element);
+
 protected:
   LIBXMLPP_API
   void initialize_context() override;
@@ -152,6 +177,12 @@ protected:
   void release_underlying() override;
 
 private:
+  friend class SaxParser;
+
+  // Used by SaxParser::set_xsd_validator().
+  _xmlSchemaSAXPlug* plug(_xmlParserCtxt* parser_context);
+  void check_stream_validity();
+
   struct Impl;
   std::unique_ptr<Impl> pimpl_;
 };
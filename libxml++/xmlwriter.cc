@@ -0,0 +1,242 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/xmlwriter.h>
+#include <libxml++/exceptions/internal_error.h>
+#include <libxml++/io/ostreamoutputbuffer.h>
+
+#include <libxml/xmlwriter.h>
+
+namespace
+{
+// nullptr for an empty string, as libxml2 wants for omitted values.
+const xmlChar* to_xml_or_null(const xmlpp::ustring& str)
+{
+  return str.empty() ? nullptr : (const xmlChar*)str.c_str();
+}
+
+void check(int result, const char* function)
+{
+  if (result < 0)
+    throw xmlpp::exception(xmlpp::ustring("XmlWriter::") + function + "() failed.\n" +
+      xmlpp::format_xml_error());
+}
+} // anonymous namespace
+
+namespace xmlpp
+{
+
+struct XmlWriter::Impl
+{
+  ~Impl()
+  {
+    // Flushes and closes the xmlOutputBuffer, which calls the output buffer's
+    // do_close(). The OStreamOutputBuffer is deleted afterwards.
+    if (writer)
+      xmlFreeTextWriter(writer);
+  }
+
+  void write_attributes(std::initializer_list<Attribute> attributes)
+  {
+    for (const auto& attribute : attributes)
+      check(xmlTextWriterWriteAttribute(writer, (const xmlChar*)attribute.name.c_str(),
+        (const xmlChar*)attribute.value.c_str()), "write_attribute");
+  }
+
+  // Used by the writer, if it writes to a stream.
+  std::unique_ptr<OStreamOutputBuffer> stream_buffer;
+  xmlTextWriterPtr writer = nullptr;
+};
+
+XmlWriter::ElementScope::ElementScope(ElementScope&& other) noexcept
+: writer_(other.writer_)
+{
+  other.writer_ = nullptr;
+}
+
+XmlWriter::ElementScope::~ElementScope()
+{
+  if (writer_)
+    xmlTextWriterEndElement(writer_->cobj());
+}
+
+void XmlWriter::ElementScope::end()
+{
+  if (writer_)
+  {
+    auto writer = writer_;
+    writer_ = nullptr;
+    writer->end_element();
+  }
+}
+
+XmlWriter::XmlWriter(std::ostream& output)
+: pimpl_(new Impl)
+{
+  // No encoding here. xmlTextWriterStartDocument() sets the encoder.
+  pimpl_->stream_buffer = std::make_unique<OStreamOutputBuffer>(output);
+  pimpl_->writer = xmlNewTextWriter(pimpl_->stream_buffer->cobj());
+  if (!pimpl_->writer)
+    throw internal_error("Could not create xmlTextWriter.\n" + format_xml_error());
+}
+
+XmlWriter::XmlWriter(OutputBuffer& buffer)
+: pimpl_(new Impl)
+{
+  pimpl_->writer = xmlNewTextWriter(buffer.cobj());
+  if (!pimpl_->writer)
+    throw internal_error("Could not create xmlTextWriter.\n" + format_xml_error());
+}
+
+XmlWriter::XmlWriter(const std::string& filename, int compression)
+: pimpl_(new Impl)
+{
+  pimpl_->writer = xmlNewTextWriterFilename(filename.c_str(), compression);
+  if (!pimpl_->writer)
+    throw internal_error("Could not create xmlTextWriter for " + filename + ".\n" +
+      format_xml_error());
+}
+
+XmlWriter::~XmlWriter()
+{
+}
+
+void XmlWriter::set_indent(bool indent, const ustring& indent_string)
+{
+  check(xmlTextWriterSetIndent(pimpl_->writer, indent ? 1 : 0), "set_indent");
+  check(xmlTextWriterSetIndentString(pimpl_->writer, (const xmlChar*)indent_string.c_str()),
+    "set_indent");
+}
+
+void XmlWriter::start_document(const ustring& version, const ustring& encoding,
+  const ustring& standalone)
+{
+  check(xmlTextWriterStartDocument(pimpl_->writer,
+    version.empty() ? nullptr : version.c_str(),
+    encoding.empty() ? nullptr : encoding.c_str(),
+    standalone.empty() ? nullptr : standalone.c_str()), "start_document");
+}
+
+void XmlWriter::end_document()
+{
+  check(xmlTextWriterEndDocument(pimpl_->writer), "end_document");
+  check(xmlTextWriterFlush(pimpl_->writer), "end_document");
+}
+
+void XmlWriter::write_doctype(const ustring& name, const ustring& public_id,
+  const ustring& system_id, const ustring& internal_subset)
+{
+  check(xmlTextWriterWriteDTD(pimpl_->writer, (const xmlChar*)name.c_str(),
+    to_xml_or_null(public_id), to_xml_or_null(system_id), to_xml_or_null(internal_subset)),
+    "write_doctype");
+}
+
+void XmlWriter::start_element(const ustring& name, std::initializer_list<Attribute> attributes)
+{
+  check(xmlTextWriterStartElement(pimpl_->writer, (const xmlChar*)name.c_str()), "start_element");
+  pimpl_->write_attributes(attributes);
+}
+
+void XmlWriter::start_element_ns(const ustring& prefix, const ustring& name,
+  const ustring& ns_uri, std::initializer_list<Attribute> attributes)
+{
+  check(xmlTextWriterStartElementNS(pimpl_->writer, to_xml_or_null(prefix),
+    (const xmlChar*)name.c_str(), to_xml_or_null(ns_uri)), "start_element_ns");
+  pimpl_->write_attributes(attributes);
+}
+
+XmlWriter::ElementScope XmlWriter::element_scope(const ustring& name,
+  std::initializer_list<Attribute> attributes)
+{
+  start_element(name, attributes);
+  return ElementScope(this);
+}
+
+void XmlWriter::end_element()
+{
+  check(xmlTextWriterEndElement(pimpl_->writer), "end_element");
+}
+
+void XmlWriter::write_attribute(const ustring& name, const ustring& value)
+{
+  check(xmlTextWriterWriteAttribute(pimpl_->writer, (const xmlChar*)name.c_str(),
+    (const xmlChar*)value.c_str()), "write_attribute");
+}
+
+void XmlWriter::write_attributes(std::initializer_list<Attribute> attributes)
+{
+  pimpl_->write_attributes(attributes);
+}
+
+void XmlWriter::write_attribute_ns(const ustring& prefix, const ustring& name,
+  const ustring& ns_uri, const ustring& value)
+{
+  check(xmlTextWriterWriteAttributeNS(pimpl_->writer, to_xml_or_null(prefix),
+    (const xmlChar*)name.c_str(), to_xml_or_null(ns_uri), (const xmlChar*)value.c_str()),
+    "write_attribute_ns");
+}
+
+void XmlWriter::write_element(const ustring& name, const ustring& content)
+{
+  check(xmlTextWriterWriteElement(pimpl_->writer, (const xmlChar*)name.c_str(),
+    (const xmlChar*)content.c_str()), "write_element");
+}
+
+void XmlWriter::write_text(const ustring& content)
+{
+  check(xmlTextWriterWriteString(pimpl_->writer, (const xmlChar*)content.c_str()), "write_text");
+}
+
+void XmlWriter::write_raw(const ustring& content)
+{
+  check(xmlTextWriterWriteRawLen(pimpl_->writer, (const xmlChar*)content.data(),
+    static_cast<int>(content.size())), "write_raw");
+}
+
+void XmlWriter::write_cdata(const ustring& content)
+{
+  check(xmlTextWriterWriteCDATA(pimpl_->writer, (const xmlChar*)content.c_str()), "write_cdata");
+}
+
+void XmlWriter::write_comment(const ustring& content)
+{
+  check(xmlTextWriterWriteComment(pimpl_->writer, (const xmlChar*)content.c_str()), "write_comment");
+}
+
+void XmlWriter::write_processing_instruction(const ustring& target, const ustring& content)
+{
+  check(xmlTextWriterWritePI(pimpl_->writer, (const xmlChar*)target.c_str(),
+    (const xmlChar*)content.c_str()), "write_processing_instruction");
+}
+
+void XmlWriter::flush()
+{
+  check(xmlTextWriterFlush(pimpl_->writer), "flush");
+}
+
+_xmlTextWriter* XmlWriter::cobj() noexcept
+{
+  return pimpl_->writer;
+}
+
+const _xmlTextWriter* XmlWriter::cobj() const noexcept
+{
+  return pimpl_->writer;
+}
+
+} // namespace xmlpp
@@ -0,0 +1,303 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_XMLWRITER_H
+#define __LIBXMLPP_XMLWRITER_H
+
+#include <libxml++/noncopyable.h>
+#include <libxml++/ustring.h>
+
+#include <initializer_list>
+#include <memory> // std::unique_ptr
+#include <ostream>
+#include <string>
+#include <utility> // std::move
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlTextWriter;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp
+{
+class OutputBuffer;
+
+/** Writes an XML document sequentially, without building a tree.
+ *
+ * This is a wrapper of libxml2's xmlTextWriter. The output goes through a
+ * buffer of fixed size, so a document of any size is written in constant
+ * memory. Elements are started and ended in document order:
+ * @code
+ * xmlpp::XmlWriter writer(output_stream);
+ * writer.start_document();
+ * {
+ *   auto records = writer.element_scope("records");
+ *   for (const auto& record : all_records)
+ *   {
+ *     auto element = writer.element_scope("record", { { "id", record.id } });
+ *     writer.write_element("name", record.name);
+ *   }
+ * } // </records>
+ * writer.end_document();
+ * @endcode
+ *
+ * Text and attribute values are escaped as required.
+ * Errors, such as a failed write to the output, are reported by throwing
+ * xmlpp::exception.
+ *
+ * @newin{5,8}
+ */
+class XmlWriter : public NonCopyable
+{
+public:
+  /** An attribute, for start_element() and element_scope().
+   */
+  struct Attribute
+  {
+    Attribute(ustring name_, ustring value_) noexcept
+    : name(std::move(name_)), value(std::move(value_))
+    {}
+
+    ustring name;
+    ustring value;
+  };
+
+  /** Ends an element on destruction. See element_scope().
+   */
+  class ElementScope
+  {
+  public:
+    LIBXMLPP_API ElementScope(ElementScope&& other) noexcept;
+    ElementScope& operator=(ElementScope&& other) = delete;
+
+    /** Ends the element, unless end() has been called.
+     * If ending the element fails, no exception is thrown, but subsequent
+     * calls to the writer, such as end_document(), will fail.
+     */
+    LIBXMLPP_API ~ElementScope();
+
+    /** End the element now.
+     * @throws xmlpp::exception
+     */
+    LIBXMLPP_API void end();
+
+  private:
+    friend class XmlWriter;
+    explicit ElementScope(XmlWriter* writer) noexcept : writer_(writer) {}
+
+    XmlWriter* writer_;
+  };
+
+  /** Write to a stream.
+   * The stream must outlive the writer.
+   * @param output The stream. The output is encoded as specified by start_document().
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  explicit XmlWriter(std::ostream& output);
+
+  /** Write to an output buffer.
+   * The writer takes over the buffer's underlying xmlOutputBuffer, and closes
+   * it when the writer is destroyed. The buffer object must outlive the writer,
+   * and can't be used for anything else.
+   * @param buffer The output buffer. Create it without an encoding; the output
+   *        is encoded as specified by start_document().
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  explicit XmlWriter(OutputBuffer& buffer);
+
+  /** Write to a file.
+   * @param filename The path to the file.
+   * @param compression The gzip compression level, 0 to 9, if libxml2
+   *        supports compressed output. 0 means no compression.
+   * @throws xmlpp::internal_error If the file can't be created.
+   */
+  LIBXMLPP_API
+  explicit XmlWriter(const std::string& filename, int compression = 0);
+
+  /** Flushes and closes the output.
+   * Elements that have not been ended are left open.
+   */
+  LIBXMLPP_API ~XmlWriter() override;
+
+  /** Indent the output, with one line per element.
+   * The default is no indentation.
+   * @param indent Whether to indent the output.
+   * @param indent_string The string that is written once per nesting level.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void set_indent(bool indent, const ustring& indent_string = "  ");
+
+  /** Write the XML declaration.
+   * @param version The XML version.
+   * @param encoding The encoding of the output, and of the declaration.
+   *        If empty, the output is UTF-8, and the declaration has no encoding.
+   * @param standalone "yes", "no", or empty for no standalone declaration.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void start_document(const ustring& version = "1.0", const ustring& encoding = ustring(),
+    const ustring& standalone = ustring());
+
+  /** End all open elements, and flush the output.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void end_document();
+
+  /** Write a document type declaration.
+   * @param name The name of the root element.
+   * @param public_id The public identifier, or empty.
+   * @param system_id The system identifier, or empty.
+   * @param internal_subset The internal subset, or empty.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_doctype(const ustring& name, const ustring& public_id = ustring(),
+    const ustring& system_id = ustring(), const ustring& internal_subset = ustring());
+
+  /** Start an element.
+   * @param name The element's name, with a namespace prefix if required.
+   * @param attributes The element's attributes.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void start_element(const ustring& name, std::initializer_list<Attribute> attributes = {});
+
+  /** Start an element in a namespace.
+   * @param prefix The namespace prefix, or empty for no prefix.
+   * @param name The element's local name.
+   * @param ns_uri The namespace URI. If not empty, a namespace declaration is written.
+   * @param attributes The element's attributes.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void start_element_ns(const ustring& prefix, const ustring& name, const ustring& ns_uri,
+    std::initializer_list<Attribute> attributes = {});
+
+  /** Start an element that is ended when the returned object is destroyed.
+   * @param name The element's name, with a namespace prefix if required.
+   * @param attributes The element's attributes.
+   * @returns An object that ends the element.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  ElementScope element_scope(const ustring& name, std::initializer_list<Attribute> attributes = {});
+
+  /** End the innermost open element.
+   * An element without content is written as an empty-element tag.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void end_element();
+
+  /** Write an attribute of the element that has just been started.
+   * @param name The attribute's name, with a namespace prefix if required.
+   * @param value The attribute's value.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_attribute(const ustring& name, const ustring& value);
+
+  /** Write attributes of the element that has just been started.
+   * @param attributes The attributes.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_attributes(std::initializer_list<Attribute> attributes);
+
+  /** Write an attribute in a namespace, of the element that has just been started.
+   * @param prefix The namespace prefix, or empty for no prefix.
+   * @param name The attribute's local name.
+   * @param ns_uri The namespace URI. If not empty, a namespace declaration is written.
+   * @param value The attribute's value.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_attribute_ns(const ustring& prefix, const ustring& name, const ustring& ns_uri,
+    const ustring& value);
+
+  /** Write an element that contains only text.
+   * @param name The element's name, with a namespace prefix if required.
+   * @param content The element's text.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_element(const ustring& name, const ustring& content);
+
+  /** Write text.
+   * @param content The text, which is escaped as required.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_text(const ustring& content);
+
+  /** Write text without escaping it.
+   * @param content The text, which must be well-formed XML.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_raw(const ustring& content);
+
+  /** Write a CDATA section.
+   * @param content The contents of the CDATA section.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_cdata(const ustring& content);
+
+  /** Write a comment.
+   * @param content The text of the comment.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_comment(const ustring& content);
+
+  /** Write a processing instruction.
+   * @param target The target of the processing instruction.
+   * @param content The contents of the processing instruction.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void write_processing_instruction(const ustring& target, const ustring& content);
+
+  /** Write buffered output to the stream, buffer or file.
+   * @throws xmlpp::exception
+   */
+  LIBXMLPP_API
+  void flush();
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  _xmlTextWriter* cobj() noexcept;
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  const _xmlTextWriter* cobj() const noexcept;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_XMLWRITER_H
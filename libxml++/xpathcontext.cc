@@ -0,0 +1,377 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/xpathcontext.h>
+#include <libxml++/xpathexpression.h>
+#include <libxml++/exceptions/internal_error.h>
+
+#include <libxml/hash.h>
+#include <libxml/xpath.h>
+#include <libxml/xpathInternals.h>
+
+#include <exception>
+#include <map>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+std::string_view to_view(const xmlChar* str) noexcept
+{
+  return str ? std::string_view(reinterpret_cast<const char*>(str)) : std::string_view();
+}
+
+// Compare find_common2() in nodes/node.cc.
+xmlpp::Node::const_NodeSet to_nodeset(xmlNodeSet* nodeset)
+{
+  xmlpp::Node::const_NodeSet nodes;
+  if (!nodeset)
+    return nodes;
+
+  nodes.reserve(nodeset->nodeNr);
+  for (int i = 0; i < nodeset->nodeNr; ++i)
+  {
+    auto node = nodeset->nodeTab[i];
+    if (!node || node->type == XML_NAMESPACE_DECL)
+      continue;
+    xmlpp::Node::create_wrapper(node);
+    nodes.push_back(static_cast<const xmlpp::Node*>(node->_private));
+  }
+  return nodes;
+}
+
+// Takes ownership of the object.
+xmlpp::XPathContext::Value to_value(xmlXPathObject* object)
+{
+  struct Free
+  {
+    ~Free() { xmlXPathFreeObject(object); }
+    xmlXPathObject* object;
+  } free_object{object};
+
+  switch (object->type)
+  {
+  case XPATH_NODESET:
+    return to_nodeset(object->nodesetval);
+  case XPATH_BOOLEAN:
+    return static_cast<bool>(object->boolval);
+  case XPATH_NUMBER:
+    return object->floatval;
+  case XPATH_STRING:
+    return xmlpp::ustring(reinterpret_cast<const char*>(object->stringval));
+  default:
+  {
+    auto str = xmlXPathCastToString(object);
+    xmlpp::ustring result = str ? reinterpret_cast<const char*>(str) : "";
+    xmlFree(str);
+    return result;
+  }
+  }
+}
+
+xmlXPathObject* to_object(const xmlpp::Node::const_NodeSet& nodes)
+{
+  auto object = xmlXPathNewNodeSet(nullptr);
+  if (!object)
+    return nullptr;
+  for (const auto node : nodes)
+  {
+    if (node && xmlXPathNodeSetAdd(object->nodesetval, const_cast<xmlNode*>(node->cobj())) != 0)
+    {
+      xmlXPathFreeObject(object);
+      return nullptr;
+    }
+  }
+  // Expressions expect node-sets in document order.
+  xmlXPathNodeSetSort(object->nodesetval);
+  return object;
+}
+
+xmlXPathObject* to_object(const xmlpp::XPathContext::Value& value)
+{
+  switch (value.index())
+  {
+  case 0: // nodeset
+    return to_object(std::get<0>(value));
+  case 1: // boolean
+    return xmlXPathNewBoolean(std::get<1>(value));
+  case 2: // number
+    return xmlXPathNewFloat(std::get<2>(value));
+  default: // string
+    return xmlXPathNewString((const xmlChar*)std::get<3>(value).c_str());
+  }
+}
+} // anonymous namespace
+
+namespace xmlpp
+{
+
+struct XPathContext::Impl
+{
+  Impl()
+  : ctxt(xmlXPathNewContext(nullptr))
+  {
+    if (!ctxt)
+      throw internal_error("Could not create XPath context.");
+    context_size = ctxt->contextSize;
+    proximity_position = ctxt->proximityPosition;
+    // Used by call_function().
+    ctxt->userData = this;
+  }
+
+  ~Impl()
+  {
+    xmlXPathFreeContext(ctxt);
+  }
+
+  void begin_evaluation(const xmlNode* node) noexcept
+  {
+    ctxt->doc = node->doc;
+    ctxt->node = const_cast<xmlNode*>(node);
+    ctxt->contextSize = context_size;
+    ctxt->proximityPosition = proximity_position;
+  }
+
+  void end_evaluation() noexcept
+  {
+    // Don't keep pointers into a document that may be deleted.
+    ctxt->doc = nullptr;
+    ctxt->node = nullptr;
+  }
+
+  static void call_function(xmlXPathParserContext* parser_ctxt, int nargs);
+
+  xmlXPathContext* ctxt;
+  // The initial values, restored before each evaluation.
+  int context_size;
+  int proximity_position;
+
+  // Registered functions, by namespace URI and name.
+  std::map<ustring, std::map<ustring, Function, std::less<>>, std::less<>> functions;
+  // An exception thrown by a function during the current evaluation.
+  std::exception_ptr exception;
+};
+
+//static
+void XPathContext::Impl::call_function(xmlXPathParserContext* parser_ctxt, int nargs)
+{
+  // libxml2 stores the name of the called function in the context.
+  // A compiled expression keeps a pointer to this function after its first
+  // evaluation, so it may be called from a context where the function is not
+  // registered.
+  auto impl = static_cast<Impl*>(parser_ctxt->context->userData);
+  const Function* func = nullptr;
+  if (impl)
+  {
+    const auto ns_functions = impl->functions.find(to_view(parser_ctxt->context->functionURI));
+    if (ns_functions != impl->functions.end())
+    {
+      const auto iter = ns_functions->second.find(to_view(parser_ctxt->context->function));
+      if (iter != ns_functions->second.end())
+        func = &iter->second;
+    }
+  }
+  if (!func)
+  {
+    xmlXPathErr(parser_ctxt, XPATH_UNKNOWN_FUNC_ERROR);
+    return;
+  }
+
+  try
+  {
+    // The arguments are on the stack, with the last one on top.
+    std::vector<Value> args(nargs);
+    for (int i = nargs - 1; i >= 0; --i)
+    {
+      auto object = valuePop(parser_ctxt);
+      if (!object)
+      {
+        xmlXPathErr(parser_ctxt, XPATH_STACK_ERROR);
+        return;
+      }
+      args[i] = to_value(object);
+    }
+
+    auto result = to_object((*func)(args));
+    if (!result)
+    {
+      xmlXPathErr(parser_ctxt, XPATH_MEMORY_ERROR);
+      return;
+    }
+    valuePush(parser_ctxt, result);
+  }
+  catch (...)
+  {
+    if (!impl->exception)
+      impl->exception = std::current_exception();
+    // Stops the evaluation. Not xmlXPathErr(), which would print an error message.
+    parser_ctxt->error = XPATH_EXPR_ERROR;
+  }
+}
+
+XPathContext::XPathContext()
+: pimpl_(new Impl)
+{
+}
+
+XPathContext::XPathContext(const Node::PrefixNsMap& namespaces)
+: pimpl_(new Impl)
+{
+  for (const auto& [prefix, ns_uri] : namespaces)
+    register_namespace(prefix, ns_uri);
+}
+
+XPathContext::~XPathContext()
+{
+}
+
+void XPathContext::register_namespace(const ustring& prefix, const ustring& ns_uri)
+{
+  // xmlXPathRegisterNs() replaces the URI of a registered prefix.
+  if (xmlXPathRegisterNs(pimpl_->ctxt, (const xmlChar*)prefix.c_str(),
+    (const xmlChar*)ns_uri.c_str()) != 0)
+    throw internal_error("Could not register namespace prefix " + prefix);
+}
+
+void XPathContext::set_variable(const ustring& name, xmlXPathObject* value)
+{
+  if (!value)
+    throw internal_error("Could not create the value of XPath variable " + name);
+
+  // On success, xmlXPathRegisterVariable() takes ownership of the value,
+  // and frees a previous value.
+  if (xmlXPathRegisterVariable(pimpl_->ctxt, (const xmlChar*)name.c_str(), value) != 0)
+  {
+    xmlXPathFreeObject(value);
+    throw internal_error("Could not register XPath variable " + name);
+  }
+}
+
+void XPathContext::set_variable_string(const ustring& name, const ustring& value)
+{
+  set_variable(name, xmlXPathNewString((const xmlChar*)value.c_str()));
+}
+
+void XPathContext::set_variable_number(const ustring& name, double value)
+{
+  set_variable(name, xmlXPathNewFloat(value));
+}
+
+void XPathContext::set_variable_boolean(const ustring& name, bool value)
+{
+  set_variable(name, xmlXPathNewBoolean(value));
+}
+
+void XPathContext::set_variable_nodeset(const ustring& name, const Node::const_NodeSet& value)
+{
+  set_variable(name, to_object(value));
+}
+
+XPathResultType XPathContext::get_variable_type(const ustring& name) const
+{
+  // Not xmlXPathVariableLookup(), which returns a copy of the value.
+  const auto value = static_cast<const xmlXPathObject*>(
+    xmlHashLookup(pimpl_->ctxt->varHash, (const xmlChar*)name.c_str()));
+  if (!value)
+    return XPathResultType::UNDEFINED;
+
+  switch (value->type)
+  {
+  case XPATH_NODESET:
+  case XPATH_BOOLEAN:
+  case XPATH_NUMBER:
+  case XPATH_STRING:
+    return static_cast<XPathResultType>(value->type);
+  default:
+    return XPathResultType::UNDEFINED;
+  }
+}
+
+void XPathContext::unset_variable(const ustring& name)
+{
+  // A null value removes the variable.
+  xmlXPathRegisterVariable(pimpl_->ctxt, (const xmlChar*)name.c_str(), nullptr);
+}
+
+void XPathContext::unset_all_variables()
+{
+  xmlXPathRegisteredVariablesCleanup(pimpl_->ctxt);
+}
+
+void XPathContext::register_function(const ustring& name, const ustring& ns_uri, Function func)
+{
+  if (xmlXPathRegisterFuncNS(pimpl_->ctxt, (const xmlChar*)name.c_str(),
+    ns_uri.empty() ? nullptr : (const xmlChar*)ns_uri.c_str(), &Impl::call_function) != 0)
+    throw internal_error("Could not register XPath function " + name);
+  pimpl_->functions[ns_uri][name] = std::move(func);
+}
+
+void XPathContext::register_function(const ustring& name, Function func)
+{
+  register_function(name, ustring(), std::move(func));
+}
+
+void XPathContext::unregister_function(const ustring& name, const ustring& ns_uri)
+{
+  // A null function removes the registration.
+  xmlXPathRegisterFuncNS(pimpl_->ctxt, (const xmlChar*)name.c_str(),
+    ns_uri.empty() ? nullptr : (const xmlChar*)ns_uri.c_str(), nullptr);
+  const auto ns_functions = pimpl_->functions.find(ns_uri);
+  if (ns_functions != pimpl_->functions.end())
+    ns_functions->second.erase(name);
+}
+
+_xmlXPathContext* XPathContext::cobj() noexcept
+{
+  return pimpl_->ctxt;
+}
+
+const _xmlXPathContext* XPathContext::cobj() const noexcept
+{
+  return pimpl_->ctxt;
+}
+
+_xmlXPathObject* XPathContext::evaluate(const XPathExpression& xpath, const _xmlNode* node)
+{
+  pimpl_->begin_evaluation(node);
+  auto result = xmlXPathCompiledEval(const_cast<xmlXPathCompExpr*>(xpath.cobj()), pimpl_->ctxt);
+  pimpl_->end_evaluation();
+
+  if (pimpl_->exception)
+  {
+    if (result)
+      xmlXPathFreeObject(result);
+    std::rethrow_exception(std::exchange(pimpl_->exception, nullptr));
+  }
+  return result;
+}
+
+int XPathContext::evaluate_to_boolean(const XPathExpression& xpath, const _xmlNode* node)
+{
+  pimpl_->begin_evaluation(node);
+  // Stops at the first node, where possible.
+  const int result = xmlXPathCompiledEvalToBoolean(
+    const_cast<xmlXPathCompExpr*>(xpath.cobj()), pimpl_->ctxt);
+  pimpl_->end_evaluation();
+
+  if (pimpl_->exception)
+    std::rethrow_exception(std::exchange(pimpl_->exception, nullptr));
+  return result;
+}
+
+} // namespace xmlpp
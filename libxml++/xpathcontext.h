@@ -0,0 +1,233 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_XPATHCONTEXT_H
+#define __LIBXMLPP_XPATHCONTEXT_H
+
+#include <libxml++/noncopyable.h>
+#include <libxml++/nodes/node.h>
+
+#include <functional>
+#include <memory> // std::unique_ptr
+#include <variant>
+#include <vector>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlXPathContext;
+  struct _xmlXPathObject;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp
+{
+class XPathExpression;
+
+/** A reusable context for the evaluation of XPath expressions.
+ *
+ * Node::find(const ustring&) and similar methods create a libxml2 XPath
+ * context and register all namespaces every time they are called. An
+ * %XPathContext is created once, with its namespaces, and then used by
+ * Node::find(const XPathExpression&, XPathContext&) and similar methods.
+ *
+ * The document and the context node are set by each evaluation, so one
+ * %XPathContext can be used with nodes in different documents.
+ *
+ * Values can be bound to variables, which are referenced as <tt>$name</tt>
+ * in an expression. One compiled expression can then be evaluated with
+ * different values, instead of building a new expression string with each
+ * value, and escaping it:
+ * @code
+ * const xmlpp::XPathExpression expr("//order[@id = $id]");
+ * xmlpp::XPathContext context;
+ * for (const auto& id : ids)
+ * {
+ *   context.set_variable_string("id", id);
+ *   auto orders = root->find(expr, context);
+ *   ...
+ * }
+ * @endcode
+ *
+ * C++ functions can be called from an expression. They can make filtering
+ * possible in the XPath engine that would otherwise be done in C++ code on a
+ * large intermediate NodeSet:
+ * @code
+ * xmlpp::XPathContext context;
+ * context.register_namespace("my", "urn:my-functions");
+ * context.register_function("known", "urn:my-functions",
+ *   [&known_ids](const std::vector<xmlpp::XPathContext::Value>& args) -> xmlpp::XPathContext::Value
+ *   {
+ *     return known_ids.count(std::get<xmlpp::ustring>(args.at(0))) != 0;
+ *   });
+ * auto orders = root->find(xmlpp::XPathExpression("//order[my:known(string(@id))]"), context);
+ * @endcode
+ * An %XPathContext must not be used by more than one thread at a time.
+ *
+ * @newin{5,8}
+ */
+class XPathContext : public NonCopyable
+{
+public:
+  /** A value that is passed to or returned from a function.
+   * The alternatives are in the same order as in the result of Node::eval_xpath().
+   * A node-set is in document order.
+   */
+  using Value = std::variant<Node::const_NodeSet, bool, double, ustring>;
+
+  /** A function that can be called from an XPath expression.
+   * It's called with the values of the arguments in the expression.
+   * If it throws an exception, the evaluation of the expression stops, and
+   * the exception is rethrown to the caller of Node::find() or similar method.
+   */
+  using Function = std::function<Value(const std::vector<Value>& args)>;
+
+  /** Create a context without namespaces.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  XPathContext();
+
+  /** Create a context with namespaces.
+   * @param namespaces A map of namespace prefixes to namespace URIs to be used while evaluating.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  explicit XPathContext(const Node::PrefixNsMap& namespaces);
+
+  LIBXMLPP_API ~XPathContext() override;
+
+  /** Register a namespace prefix, or change the URI of a registered prefix.
+   * @param prefix The namespace prefix.
+   * @param ns_uri The namespace URI.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void register_namespace(const ustring& prefix, const ustring& ns_uri);
+
+  /** Bind a string value to a variable.
+   * A previous value of the variable is replaced.
+   * @param name The name of the variable, without <tt>$</tt>.
+   * @param value The value.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void set_variable_string(const ustring& name, const ustring& value);
+
+  /** Bind a number value to a variable.
+   * A previous value of the variable is replaced.
+   * @param name The name of the variable, without <tt>$</tt>.
+   * @param value The value.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void set_variable_number(const ustring& name, double value);
+
+  /** Bind a boolean value to a variable.
+   * A previous value of the variable is replaced.
+   * @param name The name of the variable, without <tt>$</tt>.
+   * @param value The value.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void set_variable_boolean(const ustring& name, bool value);
+
+  /** Bind a node-set value to a variable.
+   * A previous value of the variable is replaced.
+   * The nodes must not be deleted while they are bound to the variable.
+   * @param name The name of the variable, without <tt>$</tt>.
+   * @param value The nodes. Duplicates are ignored.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void set_variable_nodeset(const ustring& name, const Node::const_NodeSet& value);
+
+  /** Get the type of a variable's value.
+   * @param name The name of the variable, without <tt>$</tt>.
+   * @returns The type of the value, or XPathResultType::UNDEFINED if no value
+   *          is bound to the variable.
+   */
+  LIBXMLPP_API
+  XPathResultType get_variable_type(const ustring& name) const;
+
+  /** Remove the value of a variable.
+   * @param name The name of the variable, without <tt>$</tt>.
+   */
+  LIBXMLPP_API
+  void unset_variable(const ustring& name);
+
+  /** Remove the values of all variables.
+   */
+  LIBXMLPP_API
+  void unset_all_variables();
+
+  /** Register a function that can be called from an XPath expression.
+   * A previously registered function with the same name is replaced.
+   * @param name The name of the function.
+   * @param ns_uri The namespace URI of the function, or empty for no namespace.
+   *        A function in a namespace is called with a prefix that is registered
+   *        with register_namespace().
+   * @param func The function.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void register_function(const ustring& name, const ustring& ns_uri, Function func);
+
+  /** Register a function without a namespace.
+   * See register_function(const ustring&, const ustring&, Function).
+   * @param name The name of the function.
+   * @param func The function.
+   * @throws xmlpp::internal_error
+   */
+  LIBXMLPP_API
+  void register_function(const ustring& name, Function func);
+
+  /** Remove a registered function.
+   * @param name The name of the function.
+   * @param ns_uri The namespace URI of the function, or empty for no namespace.
+   */
+  LIBXMLPP_API
+  void unregister_function(const ustring& name, const ustring& ns_uri = ustring());
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  _xmlXPathContext* cobj() noexcept;
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  const _xmlXPathContext* cobj() const noexcept;
+
+private:
+  friend class Node;
+
+  void set_variable(const ustring& name, _xmlXPathObject* value);
+
+  // Evaluate an expression with node as the context node.
+  // Returns a result that the caller shall free, or nullptr if the evaluation fails.
+  _xmlXPathObject* evaluate(const XPathExpression& xpath, const _xmlNode* node);
+
+  // Evaluate an expression, and convert the result to boolean.
+  // Returns -1 if the evaluation fails.
+  int evaluate_to_boolean(const XPathExpression& xpath, const _xmlNode* node);
+
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_XPATHCONTEXT_H
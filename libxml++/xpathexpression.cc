@@ -0,0 +1,73 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/xpathexpression.h>
+#include <libxml++/exceptions/exception.h>
+
+#include <libxml/xpath.h>
+
+namespace xmlpp
+{
+
+struct XPathExpression::Impl
+{
+  explicit Impl(const ustring& xpath_)
+  : xpath(xpath_)
+  {}
+
+  ~Impl()
+  {
+    if (comp)
+      xmlXPathFreeCompExpr(comp);
+  }
+
+  ustring xpath;
+  xmlXPathCompExpr* comp = nullptr;
+};
+
+XPathExpression::XPathExpression(const ustring& xpath)
+: pimpl_(new Impl(xpath))
+{
+  pimpl_->comp = xmlXPathCompile((const xmlChar*)xpath.c_str());
+  if (!pimpl_->comp)
+    throw exception("Invalid XPath: " + xpath);
+}
+
+XPathExpression::XPathExpression(XPathExpression&& other) noexcept = default;
+XPathExpression& XPathExpression::operator=(XPathExpression&& other) noexcept = default;
+
+XPathExpression::~XPathExpression()
+{
+}
+
+const ustring& XPathExpression::get_expression() const noexcept
+{
+  return pimpl_->xpath;
+}
+
+_xmlXPathCompExpr* XPathExpression::cobj() noexcept
+{
+  return pimpl_->comp;
+}
+
+const _xmlXPathCompExpr* XPathExpression::cobj() const noexcept
+{
+  return pimpl_->comp;
+}
+
+} // namespace xmlpp
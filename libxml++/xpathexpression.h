@@ -0,0 +1,97 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_XPATHEXPRESSION_H
+#define __LIBXMLPP_XPATHEXPRESSION_H
+
+#include <libxml++config.h>
+#include <libxml++/ustring.h>
+
+#include <memory> // std::unique_ptr
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlXPathCompExpr;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp
+{
+
+/** A compiled XPath expression.
+ *
+ * Node::find(const ustring&) and similar methods compile the expression
+ * every time they are called. An %XPathExpression is compiled once, and can
+ * then be evaluated any number of times, with any context node, in any
+ * document, with Node::find(const XPathExpression&, XPathContext&) and
+ * similar methods:
+ * @code
+ * const xmlpp::XPathExpression expr("item[@id]");
+ * xmlpp::XPathContext context;
+ * for (auto element : root->child_elements("list"))
+ *   for (auto item : element->find(expr, context))
+ *     ...
+ * @endcode
+ *
+ * Namespace prefixes in the expression are resolved when it's evaluated, with
+ * the namespaces that are registered in the XPathContext.
+ *
+ * An %XPathExpression can be moved, but not copied. A moved-from expression
+ * can only be assigned to or destroyed.
+ *
+ * @newin{5,8}
+ */
+class XPathExpression
+{
+public:
+  /** Compile an XPath expression.
+   * @param xpath The XPath expression.
+   * @throws xmlpp::exception If the XPath expression cannot be compiled.
+   */
+  LIBXMLPP_API
+  explicit XPathExpression(const ustring& xpath);
+
+  LIBXMLPP_API XPathExpression(XPathExpression&& other) noexcept;
+  LIBXMLPP_API XPathExpression& operator=(XPathExpression&& other) noexcept;
+  XPathExpression(const XPathExpression&) = delete;
+  XPathExpression& operator=(const XPathExpression&) = delete;
+
+  LIBXMLPP_API ~XPathExpression();
+
+  /** Get the source text of the expression.
+   * @returns The XPath expression, as given to the constructor.
+   */
+  LIBXMLPP_API
+  const ustring& get_expression() const noexcept;
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  _xmlXPathCompExpr* cobj() noexcept;
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  const _xmlXPathCompExpr* cobj() const noexcept;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_XPATHEXPRESSION_H
@@ -0,0 +1,83 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/xpathnodeset.h>
+
+#include <libxml/xpathInternals.h>
+
+#include <utility> // std::exchange
+
+namespace xmlpp
+{
+
+XPathNodeSetBase::XPathNodeSetBase(_xmlXPathObject* result) noexcept
+: result_(result)
+{
+  auto nodeset = result_ ? result_->nodesetval : nullptr;
+  if (!nodeset)
+    return;
+
+  // Remove the namespace nodes, which are xmlNs structs, and can't be
+  // represented by a Node or NodeRef. They are copies, owned by the node-set.
+  int n_nodes = 0;
+  for (int i = 0; i < nodeset->nodeNr; ++i)
+  {
+    auto cnode = nodeset->nodeTab[i];
+    if (cnode && cnode->type == XML_NAMESPACE_DECL)
+      xmlXPathNodeSetFreeNs(reinterpret_cast<xmlNs*>(cnode));
+    else if (cnode)
+      nodeset->nodeTab[n_nodes++] = cnode;
+  }
+  nodeset->nodeNr = n_nodes;
+}
+
+XPathNodeSetBase::XPathNodeSetBase(XPathNodeSetBase&& other) noexcept
+: result_(std::exchange(other.result_, nullptr))
+{
+}
+
+XPathNodeSetBase& XPathNodeSetBase::operator=(XPathNodeSetBase&& other) noexcept
+{
+  if (this != &other)
+  {
+    if (result_)
+      xmlXPathFreeObject(result_);
+    result_ = std::exchange(other.result_, nullptr);
+  }
+  return *this;
+}
+
+XPathNodeSetBase::~XPathNodeSetBase()
+{
+  if (result_)
+    xmlXPathFreeObject(result_);
+}
+
+std::size_t XPathNodeSetBase::size() const noexcept
+{
+  if (!(result_ && result_->nodesetval))
+    return 0;
+  return static_cast<std::size_t>(result_->nodesetval->nodeNr);
+}
+
+_xmlNode* XPathNodeSetBase::get(std::size_t index) const noexcept
+{
+  return result_->nodesetval->nodeTab[index];
+}
+
+} // namespace xmlpp
@@ -0,0 +1,186 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_XPATHNODESET_H
+#define __LIBXMLPP_XPATHNODESET_H
+
+#include <libxml++config.h>
+#include <libxml++/nodes/noderange.h>
+
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <iterator>
+#include <type_traits>
+#include <utility> // std::move
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlNode;
+  struct _xmlXPathObject;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp
+{
+
+/** The part of XPathNodeSet that does not depend on the value type.
+ *
+ * @newin{5,8}
+ */
+class LIBXMLPP_API XPathNodeSetBase
+{
+public:
+  /** Create an empty node-set.
+   */
+  XPathNodeSetBase() noexcept = default;
+
+  /** Take ownership of the result of an XPath evaluation.
+   * Namespace nodes are removed from the node-set.
+   * @param result An xmlXPathObject of type XPATH_NODESET, or <tt>nullptr</tt>.
+   */
+  explicit XPathNodeSetBase(_xmlXPathObject* result) noexcept;
+
+  XPathNodeSetBase(const XPathNodeSetBase&) = delete;
+  XPathNodeSetBase& operator=(const XPathNodeSetBase&) = delete;
+  XPathNodeSetBase(XPathNodeSetBase&& other) noexcept;
+  XPathNodeSetBase& operator=(XPathNodeSetBase&& other) noexcept;
+  ~XPathNodeSetBase();
+
+  /// The number of nodes.
+  std::size_t size() const noexcept;
+
+  /// Whether the node-set has no nodes.
+  bool empty() const noexcept { return size() == 0; }
+
+  /// The node at position @a index, in document order.
+  _xmlNode* get(std::size_t index) const noexcept;
+
+  ///Access the underlying libxml implementation.
+  _xmlXPathObject* cobj() noexcept { return result_; }
+
+  ///Access the underlying libxml implementation.
+  const _xmlXPathObject* cobj() const noexcept { return result_; }
+
+private:
+  _xmlXPathObject* result_ = nullptr;
+};
+
+/** The nodes that an XPath expression finds, converted on demand.
+ *
+ * Unlike Node::find(), which creates the C++ wrappers of all nodes and copies
+ * them to a vector, an XPathNodeSet keeps the result of the XPath evaluation,
+ * and converts a node only when it's accessed. Values of type NodeRef or
+ * ElementRef don't need wrappers:
+ * @code
+ * xmlpp::XPathNodeSet<xmlpp::NodeRef> records(root->select("//record"));
+ * for (auto record : records)
+ *   std::cout << record.get_name_view() << std::endl;
+ * @endcode
+ *
+ * The nodes are in document order. Namespace nodes are left out, like in
+ * Node::find(). The node-set must not be used after any of its nodes has been
+ * removed from the tree.
+ *
+ * An XPathNodeSet can be moved, but not copied. It can be moved to an
+ * XPathNodeSet with another value type, but not from a value type that gives
+ * read-only access to one that gives write access, such as from
+ * <tt>const Node*</tt> to <tt>Node*</tt>.
+ *
+ * @tparam T The value type: <tt>Node*</tt>, <tt>const Node*</tt>, <tt>Element*</tt>,
+ *           <tt>const Element*</tt>, NodeRef or ElementRef. If the value type
+ *           is an Element pointer or ElementRef, the nodes that are not
+ *           elements are <tt>nullptr</tt> or refer to no node.
+ *
+ * @newin{5,8}
+ */
+template <typename T>
+class XPathNodeSet : public XPathNodeSetBase
+{
+public:
+  class iterator
+  {
+  public:
+    // The values are created when the iterator is dereferenced, so reference
+    // is not a reference type, which a forward iterator requires. The
+    // iterator has all the operations of a random access iterator, though.
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = T;
+
+    iterator() noexcept = default;
+    iterator(const XPathNodeSet* node_set, std::size_t index) noexcept
+      : node_set_(node_set), index_(index)
+      {
+      }
+
+    T operator*() const { return NodeConverter::convert<T>(node_set_->get(index_)); }
+    T operator[](difference_type n) const { return *(*this + n); }
+    iterator& operator++() noexcept { ++index_; return *this; }
+    iterator operator++(int) noexcept { auto tmp = *this; ++index_; return tmp; }
+    iterator& operator--() noexcept { --index_; return *this; }
+    iterator operator--(int) noexcept { auto tmp = *this; --index_; return tmp; }
+    iterator& operator+=(difference_type n) noexcept { index_ += n; return *this; }
+    iterator& operator-=(difference_type n) noexcept { index_ -= n; return *this; }
+    iterator operator+(difference_type n) const noexcept { auto tmp = *this; return tmp += n; }
+    iterator operator-(difference_type n) const noexcept { auto tmp = *this; return tmp -= n; }
+    difference_type operator-(const iterator& other) const noexcept
+      { return static_cast<difference_type>(index_ - other.index_); }
+    bool operator==(const iterator& other) const noexcept { return index_ == other.index_; }
+    bool operator!=(const iterator& other) const noexcept { return index_ != other.index_; }
+    bool operator<(const iterator& other) const noexcept { return index_ < other.index_; }
+    bool operator>(const iterator& other) const noexcept { return index_ > other.index_; }
+    bool operator<=(const iterator& other) const noexcept { return index_ <= other.index_; }
+    bool operator>=(const iterator& other) const noexcept { return index_ >= other.index_; }
+
+    ///Access the underlying libxml implementation.
+    _xmlNode* cobj() const noexcept { return node_set_->get(index_); }
+
+  private:
+    const XPathNodeSet* node_set_ = nullptr;
+    std::size_t index_ = 0;
+  };
+  using const_iterator = iterator;
+
+  using XPathNodeSetBase::XPathNodeSetBase;
+
+  XPathNodeSet(XPathNodeSet&& other) noexcept = default;
+  XPathNodeSet& operator=(XPathNodeSet&& other) noexcept = default;
+
+  /** Move a node-set with another value type.
+   * @param other The node-set to move. It's empty afterwards.
+   */
+  template <typename U, typename = std::enable_if_t<
+    !NodeConverter::is_writable<T> || NodeConverter::is_writable<U>>>
+  explicit XPathNodeSet(XPathNodeSet<U>&& other) noexcept
+  : XPathNodeSetBase(std::move(other))
+  {}
+
+  iterator begin() const noexcept { return iterator(this, 0); }
+  iterator end() const noexcept { return iterator(this, size()); }
+
+  /** Get the node at a position.
+   * @param index A position, less than size().
+   * @returns The node, in document order.
+   */
+  T operator[](std::size_t index) const { return NodeConverter::convert<T>(get(index)); }
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_XPATHNODESET_H
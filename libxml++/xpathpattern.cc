@@ -0,0 +1,125 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/xpathpattern.h>
+#include <libxml++/exceptions/exception.h>
+
+#include <libxml/pattern.h>
+
+#include <string>
+#include <vector>
+
+namespace xmlpp
+{
+
+struct XPathPattern::Impl
+{
+  explicit Impl(const ustring& pattern_)
+  : pattern(pattern_)
+  {}
+
+  ~Impl()
+  {
+    if (comp)
+      xmlFreePattern(comp);
+  }
+
+  ustring pattern;
+  xmlPattern* comp = nullptr;
+};
+
+XPathPattern::XPathPattern(const ustring& pattern, const Node::PrefixNsMap& namespaces)
+: pimpl_(new Impl(pattern))
+{
+  // An array of namespace URIs and prefixes, terminated by nullptr.
+  std::vector<const xmlChar*> ns_array;
+  if (!namespaces.empty())
+  {
+    ns_array.reserve(namespaces.size() * 2 + 1);
+    for (const auto& [prefix, ns_uri] : namespaces)
+    {
+      ns_array.push_back((const xmlChar*)ns_uri.c_str());
+      ns_array.push_back((const xmlChar*)prefix.c_str());
+    }
+    ns_array.push_back(nullptr);
+  }
+
+  // libxml2 rejects some whitespace, such as in "/a/b | /c". Remove the
+  // whitespace around '|', '/' and ':', and at the ends. Whitespace between
+  // two names, such as in "/a b", would join them, so it's an error.
+  const auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+  const auto is_separator = [](char c) { return c == '|' || c == '/' || c == ':'; };
+  std::string compact;
+  compact.reserve(pattern.size());
+  bool space_before = false;
+  for (const char c : pattern)
+  {
+    if (is_space(c))
+    {
+      space_before = true;
+      continue;
+    }
+    if (space_before && !compact.empty() && !is_separator(compact.back()) && !is_separator(c))
+      throw exception("Invalid pattern: " + pattern);
+    compact += c;
+    space_before = false;
+  }
+
+  pimpl_->comp = xmlPatterncompile((const xmlChar*)compact.c_str(), nullptr,
+    XML_PATTERN_DEFAULT, ns_array.empty() ? nullptr : ns_array.data());
+  if (!pimpl_->comp)
+    throw exception("Invalid pattern: " + pattern);
+  if (xmlPatternStreamable(pimpl_->comp) != 1)
+    throw exception("Pattern is not streamable: " + pattern);
+}
+
+XPathPattern::XPathPattern(XPathPattern&& other) noexcept = default;
+XPathPattern& XPathPattern::operator=(XPathPattern&& other) noexcept = default;
+
+XPathPattern::~XPathPattern()
+{
+}
+
+const ustring& XPathPattern::get_pattern() const noexcept
+{
+  return pimpl_->pattern;
+}
+
+bool XPathPattern::matches(const Node* node) const noexcept
+{
+  return matches(NodeRef(node));
+}
+
+bool XPathPattern::matches(NodeRef node) const noexcept
+{
+  if (!node)
+    return false;
+  return xmlPatternMatch(pimpl_->comp, const_cast<xmlNode*>(node.cobj())) == 1;
+}
+
+_xmlPattern* XPathPattern::cobj() noexcept
+{
+  return pimpl_->comp;
+}
+
+const _xmlPattern* XPathPattern::cobj() const noexcept
+{
+  return pimpl_->comp;
+}
+
+} // namespace xmlpp
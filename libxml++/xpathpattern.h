@@ -0,0 +1,111 @@
+/* Copyright (C) 2026 The libxml++ development team
+ *
+ * This file is part of libxml++.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LIBXMLPP_XPATHPATTERN_H
+#define __LIBXMLPP_XPATHPATTERN_H
+
+#include <libxml++config.h>
+#include <libxml++/ustring.h>
+#include <libxml++/nodes/node.h>
+#include <libxml++/nodes/noderef.h>
+
+#include <memory> // std::unique_ptr
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+extern "C" {
+  struct _xmlPattern;
+}
+#endif //DOXYGEN_SHOULD_SKIP_THIS
+
+namespace xmlpp
+{
+
+/** A compiled pattern, in the streamable subset of XPath.
+ *
+ * A pattern can be matched against nodes while a document is being parsed,
+ * without building the document, with SaxViewParser::add_pattern() and
+ * TextReader::read_to_match(). It's a location path of child and descendant
+ * steps, such as <tt>/feed/entry/id</tt> or <tt>//entry/p:link</tt>, or a
+ * union of such paths, separated by <tt>|</tt>. A step is a name, a prefixed
+ * name or <tt>*</tt>. Whitespace around <tt>|</tt>, <tt>/</tt> and <tt>:</tt>
+ * is ignored. Predicates and other axes are not supported, so
+ * <tt>/feed/entry[@type='x']/id</tt> must be written as <tt>/feed/entry/id</tt>,
+ * and the attribute tested when the <tt>entry</tt> element is seen.
+ *
+ * Namespace prefixes are resolved when the pattern is compiled.
+ *
+ * An %XPathPattern can be moved, but not copied. A moved-from pattern
+ * can only be assigned to or destroyed.
+ *
+ * @newin{5,8}
+ */
+class XPathPattern
+{
+public:
+  /** Compile a pattern.
+   * @param pattern The pattern.
+   * @param namespaces A map of namespace prefixes to namespace URIs, used in the pattern.
+   * @throws xmlpp::exception If the pattern cannot be compiled, or is not streamable.
+   */
+  LIBXMLPP_API
+  explicit XPathPattern(const ustring& pattern,
+    const Node::PrefixNsMap& namespaces = Node::PrefixNsMap());
+
+  LIBXMLPP_API XPathPattern(XPathPattern&& other) noexcept;
+  LIBXMLPP_API XPathPattern& operator=(XPathPattern&& other) noexcept;
+  XPathPattern(const XPathPattern&) = delete;
+  XPathPattern& operator=(const XPathPattern&) = delete;
+
+  LIBXMLPP_API ~XPathPattern();
+
+  /** Get the source text of the pattern.
+   * @returns The pattern, as given to the constructor.
+   */
+  LIBXMLPP_API
+  const ustring& get_pattern() const noexcept;
+
+  /** Find out if a node in a tree matches the pattern.
+   * @param node A node, or <tt>nullptr</tt>.
+   * @returns Whether the node matches.
+   */
+  LIBXMLPP_API
+  bool matches(const Node* node) const noexcept;
+
+  /** Find out if a node in a tree matches the pattern.
+   * @param node A node, or a reference to no node.
+   * @returns Whether the node matches.
+   */
+  LIBXMLPP_API
+  bool matches(NodeRef node) const noexcept;
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  _xmlPattern* cobj() noexcept;
+
+  /** Access the underlying libxml implementation. */
+  LIBXMLPP_API
+  const _xmlPattern* cobj() const noexcept;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace xmlpp
+
+#endif //__LIBXMLPP_XPATHPATTERN_H
@@ -36,6 +36,9 @@ namespace xmlpp
 /** Represents an XSD schema for validating XML files.
  * XSD = XML %Schema Definition, a.k.a. XML %Schema or W3C XML %Schema
  *
+ * A parsed schema is not modified by validation. It can be shared by several
+ * threads through a <tt>std::shared_ptr<const XsdSchema></tt>, see SharedSchemaValidator.
+ *
  * @newin{2,38}
  */
 class XsdSchema : public SchemaBase
@@ -0,0 +1,181 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using Status = xmlpp::BatchValidator::Result::Status;
+
+const char xsd_text[] =
+  "<xs:schema xmlns:xs='http://www.w3.org/2001/XMLSchema'>"
+  "<xs:element name='list'><xs:complexType><xs:sequence>"
+  "<xs:element name='item' type='xs:int' maxOccurs='unbounded'/>"
+  "</xs:sequence></xs:complexType></xs:element>"
+  "</xs:schema>";
+
+const char relaxng_text[] =
+  "<element name='list' xmlns='http://relaxng.org/ns/structure/1.0'"
+  " datatypeLibrary='http://www.w3.org/2001/XMLSchema-datatypes'>"
+  "<oneOrMore><element name='item'><data type='int'/></element></oneOrMore>"
+  "</element>";
+
+const char dtd_text[] =
+  "<!ELEMENT list (item+)>"
+  "<!ELEMENT item (#PCDATA)>";
+
+// Every 7th document has an element that is not declared, and every 11th
+// document is not well-formed.
+std::string make_document(int n)
+{
+  std::string doc = "<list>";
+  for (int i = 0; i < n % 5 + 1; ++i)
+    doc += "<item>" + std::to_string(i) + "</item>";
+  if (n % 7 == 6)
+    doc += "<other/>";
+  if (n % 11 != 10)
+    doc += "</list>";
+  return doc;
+}
+
+Status expected_status(int n)
+{
+  if (n % 11 == 10)
+    return Status::PARSE_ERROR;
+  if (n % 7 == 6)
+    return Status::INVALID;
+  return Status::VALID;
+}
+
+void test_memory(xmlpp::BatchValidator& validator)
+{
+  const int n_documents = 100;
+  std::vector<std::string> documents;
+  for (int n = 0; n < n_documents; ++n)
+    documents.push_back(make_document(n));
+
+  // Run two batches, to check that the pool can be reused.
+  for (int batch = 0; batch < 2; ++batch)
+  {
+    const auto results = validator.validate_memory(documents);
+    assert(results.size() == documents.size());
+    for (int n = 0; n < n_documents; ++n)
+    {
+      assert(results[n].status == expected_status(n));
+      assert(static_cast<bool>(results[n]) == (results[n].status == Status::VALID));
+      assert(results[n].message.empty() == static_cast<bool>(results[n]));
+    }
+  }
+
+  assert(validator.validate_memory(std::vector<std::string_view>()).empty());
+}
+
+void test_files(xmlpp::BatchValidator& validator)
+{
+  const int n_files = 22;
+  std::vector<std::string> filenames;
+  for (int n = 0; n < n_files; ++n)
+  {
+    filenames.push_back("batch_validator_" + std::to_string(n) + ".xml");
+    std::ofstream(filenames.back()) << make_document(n);
+  }
+  filenames.push_back("no_such_file.xml");
+
+  const auto results = validator.validate_files(filenames);
+  assert(results.size() == filenames.size());
+  for (int n = 0; n < n_files; ++n)
+    assert(results[n].status == expected_status(n));
+  assert(results.back().status == Status::PARSE_ERROR);
+
+  // A batch of one document, then a larger batch. The pool's threads
+  // must not run the finished batch again.
+  const auto one = validator.validate_files({filenames[1]});
+  assert(one.size() == 1);
+  assert(one[0].status == expected_status(1));
+  const auto all = validator.validate_files(filenames);
+  assert(all.size() == filenames.size());
+  for (int n = 0; n < n_files; ++n)
+    assert(all[n].status == expected_status(n));
+
+  for (int n = 0; n < n_files; ++n)
+    std::remove(filenames[n].c_str());
+}
+} // anonymous namespace
+
+int main()
+{
+  // XSD
+  {
+    auto schema = std::make_shared<xmlpp::XsdSchema>();
+    schema->parse_memory(xsd_text);
+    xmlpp::BatchValidator validator(std::move(schema), 4);
+    assert(validator.get_n_threads() == 4);
+    test_memory(validator);
+    test_files(validator);
+    assert(validator.get_validator().get_n_contexts() <= 4);
+  }
+
+  // RelaxNG
+  {
+    auto schema = std::make_shared<xmlpp::RelaxNGSchema>();
+    schema->parse_memory(relaxng_text);
+    xmlpp::BatchValidator validator(std::move(schema), 3);
+    test_memory(validator);
+    test_files(validator);
+  }
+
+  // DTD, with the default number of threads.
+  {
+    auto dtd = std::make_shared<xmlpp::Dtd>();
+    dtd->parse_memory(dtd_text);
+    xmlpp::BatchValidator validator(std::move(dtd));
+    assert(validator.get_n_threads() >= 1);
+    test_memory(validator);
+    test_files(validator);
+  }
+
+  // SharedSchemaValidator::validate_memory().
+  {
+    auto schema = std::make_shared<xmlpp::XsdSchema>();
+    schema->parse_memory(xsd_text);
+    const xmlpp::SharedSchemaValidator validator(std::move(schema));
+    validator.validate_memory(make_document(0));
+    std::string large = "<list>";
+    for (int i = 0; i < 10000; ++i)
+      large += "<item>" + std::to_string(i) + "</item>";
+    large += "</list>";
+    validator.validate_memory(large);
+    try
+    {
+      validator.validate_memory(make_document(6));
+      assert(false);
+    }
+    catch (const xmlpp::validity_error&)
+    {
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
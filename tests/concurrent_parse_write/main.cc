@@ -0,0 +1,91 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml/parser.h> // XML_PARSE_NOBLANKS
+
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const char* const input = "<root>\n  <a>text</a>\n  <b><c/></b>\n</root>";
+
+struct Output
+{
+  std::string plain;
+  std::string formatted;
+  std::string stream;
+};
+
+// Parse with or without blank text nodes, and write the document.
+Output parse_and_write(bool keep_blanks)
+{
+  xmlpp::DomParser parser;
+  if (!keep_blanks)
+    parser.set_parser_options(XML_PARSE_NOBLANKS);
+  parser.parse_memory(input);
+
+  auto doc = parser.get_document();
+  Output output;
+  output.plain = doc->write_to_string();
+  output.formatted = doc->write_to_string_formatted();
+  std::ostringstream stream;
+  doc->write_to_stream_formatted(stream);
+  output.stream = stream.str();
+  return output;
+}
+} // anonymous namespace
+
+int main()
+{
+  const auto with_blanks = parse_and_write(true);
+  const auto without_blanks = parse_and_write(false);
+
+  // The blank text nodes are kept by default.
+  assert(with_blanks.plain.find("<root>\n  <a>") != std::string::npos);
+  assert(without_blanks.plain.find("<root><a>") != std::string::npos);
+  // Formatting indents a document without blank text nodes.
+  assert(without_blanks.formatted.find("<root>\n  <a>text</a>\n  <b>\n    <c/>\n  </b>\n</root>") != std::string::npos);
+  assert(without_blanks.stream == without_blanks.formatted);
+
+  // Parsers and writers with different settings in several threads
+  // don't affect each other.
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t)
+  {
+    threads.emplace_back([t, &with_blanks, &without_blanks]
+    {
+      const bool keep_blanks = t % 2 == 0;
+      const auto& expected = keep_blanks ? with_blanks : without_blanks;
+      for (int i = 0; i < 200; ++i)
+      {
+        const auto output = parse_and_write(keep_blanks);
+        assert(output.plain == expected.plain);
+        assert(output.formatted == expected.formatted);
+        assert(output.stream == expected.stream);
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+const std::string input =
+  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+  "<root xmlns:p=\"urn:p\"><a id=\"1\">x &amp; y</a><p:b>\xc3\xa5\xc3\xa4</p:b><!--c--></root>\n";
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser reference;
+  reference.parse_memory(input);
+  const auto expected = reference.get_document()->write_to_string();
+
+  // One byte at a time, which splits the UTF-8 sequences.
+  xmlpp::DomParser parser;
+  assert(parser);
+  for (const char c : input)
+  {
+    parser.parse_chunk_raw((const unsigned char*)&c, 1);
+    assert(!parser && !parser.get_document());
+  }
+  parser.finish_chunk_parsing();
+  assert(parser);
+  assert(parser.get_document()->write_to_string() == expected);
+  assert(parser.get_document()->get_root_node()->eval_to_string("a") == "x & y");
+
+  // A new chunk-wise parse replaces the document.
+  parser.parse_chunk(input.substr(0, 20));
+  parser.parse_chunk(input.substr(20));
+  parser.finish_chunk_parsing();
+  assert(parser.get_document()->write_to_string() == expected);
+
+  // Other parse methods still work.
+  parser.parse_memory("<other/>");
+  assert(parser.get_document()->get_root_node()->get_name2() == "other");
+
+  // Errors.
+  try
+  {
+    parser.parse_chunk("<root><a></b>");
+    assert(false);
+  }
+  catch (const xmlpp::parse_error&)
+  {
+  }
+  assert(!parser);
+
+  try
+  {
+    parser.parse_chunk("<root>");
+    parser.finish_chunk_parsing();
+    assert(false);
+  }
+  catch (const xmlpp::parse_error&)
+  {
+  }
+  assert(!parser);
+
+  try
+  {
+    parser.finish_chunk_parsing();
+    assert(false);
+  }
+  catch (const xmlpp::parse_error&)
+  {
+  }
+
+  // An XInclude error after the parse.
+  parser.set_xinclude_options(true);
+  try
+  {
+    parser.parse_chunk("<root xmlns:xi=\"http://www.w3.org/2001/XInclude\">"
+      "<xi:include href=\"nonexistent.xml\"/></root>");
+    parser.finish_chunk_parsing();
+    assert(false);
+  }
+  catch (const xmlpp::parse_error&)
+  {
+  }
+  assert(!parser);
+  parser.set_xinclude_options(false);
+
+  // The parser can be used after an error.
+  parser.parse_chunk("<root/>");
+  parser.finish_chunk_parsing();
+  assert(parser.get_document()->get_root_node()->get_name2() == "root");
+
+  return EXIT_SUCCESS;
+}
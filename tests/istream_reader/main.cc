@@ -0,0 +1,191 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml++/io/istreamreader.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// A streambuf that throws after a number of bytes.
+class throwing_streambuf : public std::streambuf
+{
+public:
+  throwing_streambuf(const std::string& contents, std::size_t throw_at)
+  : contents_(contents), throw_at_(throw_at)
+  {}
+
+protected:
+  int_type underflow() override
+  {
+    if (ofs_ >= throw_at_)
+      throw std::runtime_error("read error");
+    if (ofs_ >= contents_.size())
+      return traits_type::eof();
+    return traits_type::to_int_type(contents_[ofs_]);
+  }
+
+  int_type uflow() override
+  {
+    const auto c = underflow();
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+      ++ofs_;
+    return c;
+  }
+
+private:
+  std::string contents_;
+  std::size_t throw_at_;
+  std::size_t ofs_ = 0;
+};
+
+std::string read_all(xmlpp::IStreamReader& reader, int len)
+{
+  std::string result;
+  std::string buffer(len, '\0');
+  int n;
+  while ((n = reader.read(&buffer[0], len)) > 0)
+    result.append(buffer, 0, n);
+  assert(n == 0);
+  return result;
+}
+
+std::string make_document(int n_elements)
+{
+  std::string doc = "<root>";
+  for (int i = 0; i < n_elements; ++i)
+    doc += "<item n=\"" + std::to_string(i) + "\">text</item>";
+  doc += "</root>";
+  return doc;
+}
+
+int main()
+{
+  const auto contents = make_document(2000);
+
+  // Block sizes smaller, equal to and larger than the reads, with and without read-ahead.
+  for (const bool read_ahead : { false, true })
+  {
+    for (const std::size_t block_size : { 1, 7, 100, 4096, 1000000 })
+    {
+      for (const int len : { 1, 100, 4096 })
+      {
+        std::istringstream in(contents);
+        xmlpp::IStreamReader reader(in, block_size, read_ahead);
+        assert(reader.get_block_size() == block_size);
+        assert(reader.get_read_ahead() == read_ahead);
+        assert(read_all(reader, len) == contents);
+        // As after a short std::istream::read().
+        assert(in.eof());
+        assert(in.fail());
+        assert(!in.bad());
+      }
+    }
+  }
+
+  // A block size of 0 means the default.
+  {
+    std::istringstream in(contents);
+    xmlpp::IStreamReader reader(in, 0);
+    assert(reader.get_block_size() == xmlpp::IStreamReader::default_block_size);
+  }
+
+  // An empty stream, and a stream that is not good.
+  for (const bool read_ahead : { false, true })
+  {
+    std::istringstream empty;
+    xmlpp::IStreamReader reader(empty, 16, read_ahead);
+    char buffer[16];
+    assert(reader.read(buffer, sizeof(buffer)) == 0);
+
+    std::istringstream failed("<root/>");
+    failed.setstate(std::ios_base::failbit);
+    xmlpp::IStreamReader reader2(failed, 16, read_ahead);
+    assert(reader2.read(buffer, sizeof(buffer)) == 0);
+  }
+
+  // An exception from the streambuf is reported as an error, not thrown.
+  for (const bool read_ahead : { false, true })
+  {
+    throwing_streambuf buf(contents, 1000);
+    std::istream in(&buf);
+    xmlpp::IStreamReader reader(in, 64, read_ahead);
+    char buffer[64];
+    int total = 0;
+    int n;
+    while ((n = reader.read(buffer, sizeof(buffer))) > 0)
+      total += n;
+    // Bytes of the block that was being read when the exception was thrown are lost.
+    assert(n == -1);
+    assert(total == 1000 / 64 * 64);
+    assert(in.bad());
+  }
+
+  // Destroying a read-ahead reader before the end of the stream.
+  {
+    std::istringstream in(contents);
+    xmlpp::IStreamReader reader(in, 16, true);
+    char buffer[4];
+    assert(reader.read(buffer, sizeof(buffer)) == 4);
+  }
+
+  // The parsers, with small blocks and read-ahead.
+  for (const bool read_ahead : { false, true })
+  {
+    xmlpp::DomParser dom_parser;
+    dom_parser.set_stream_block_size(10);
+    dom_parser.set_stream_read_ahead(read_ahead);
+    assert(dom_parser.get_stream_block_size() == 10);
+    assert(dom_parser.get_stream_read_ahead() == read_ahead);
+    std::istringstream in(contents);
+    dom_parser.parse_stream(in);
+    const auto root = dom_parser.get_document()->get_root_node();
+    assert(root->get_children("item").size() == 2000);
+
+    xmlpp::SaxParser sax_parser;
+    sax_parser.set_stream_block_size(10);
+    sax_parser.set_stream_read_ahead(read_ahead);
+    std::istringstream in2(contents);
+    sax_parser.parse_stream(in2);
+
+    // A read error is a parse error.
+    throwing_streambuf buf(contents, 1000);
+    std::istream bad_in(&buf);
+    bool thrown = false;
+    try
+    {
+      dom_parser.parse_stream(bad_in);
+    }
+    catch (const xmlpp::exception&)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+
+  // Dtd::parse_stream() reads through IStreamParserInputBuffer.
+  {
+    std::istringstream in("<!ELEMENT root (#PCDATA)>");
+    xmlpp::Dtd dtd;
+    dtd.parse_stream(in);
+    assert(dtd.cobj());
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace
+{
+const char* const document =
+  "<?xml version=\"1.0\"?>\n"
+  "<list><item>1</item><item>2</item><!--c--><item a=\"x\">3</item></list>\n";
+
+void write_file(const std::string& filename, const std::string& contents)
+{
+  std::ofstream out(filename, std::ios::binary);
+  out << contents;
+}
+
+class CountingParser : public xmlpp::SaxParser
+{
+public:
+  int elements = 0;
+  std::string text;
+
+protected:
+  void on_start_element(const xmlpp::ustring& /* name */, const AttributeList& /* attributes */) override
+  {
+    ++elements;
+  }
+
+  void on_characters(const xmlpp::ustring& characters) override
+  {
+    text += characters;
+  }
+};
+
+template <typename Exception, typename F>
+bool throws(F f)
+{
+  try
+  {
+    f();
+  }
+  catch (const Exception&)
+  {
+    return true;
+  }
+  return false;
+}
+} // anonymous namespace
+
+int main()
+{
+  const std::string filename = "mapped_file_test.xml";
+  const std::string empty_filename = "mapped_file_test_empty.xml";
+  const std::string missing_filename = "mapped_file_test_missing.xml";
+  write_file(filename, document);
+  write_file(empty_filename, "");
+  std::remove(missing_filename.c_str());
+
+  // MappedFile.
+  {
+    xmlpp::MappedFile file(filename);
+    assert(file.get_filename() == filename);
+    assert(file.size() == std::strlen(document));
+    assert(std::memcmp(file.data(), document, file.size()) == 0);
+
+    // read() copies the mapping block by block.
+    std::string contents;
+    char buffer[10];
+    int n;
+    while ((n = file.read(buffer, sizeof(buffer))) > 0)
+      contents.append(buffer, n);
+    assert(contents == document);
+    file.rewind();
+    assert(file.read(buffer, sizeof(buffer)) == sizeof(buffer));
+
+    // Moving transfers the mapping.
+    xmlpp::MappedFile moved(std::move(file));
+    assert(moved.size() == std::strlen(document));
+
+    xmlpp::MappedFile empty(empty_filename);
+    assert(empty.size() == 0);
+    assert(empty.read(buffer, sizeof(buffer)) == 0);
+
+    assert(throws<xmlpp::internal_error>([&]{ xmlpp::MappedFile missing(missing_filename); }));
+  }
+
+  // DomParser.
+  {
+    xmlpp::DomParser parser;
+    parser.parse_mapped_file(filename);
+    auto root = parser.get_document()->get_root_node();
+    assert(root->get_name2() == "list");
+    assert(root->get_children().size() == 4);
+
+    // The same errors as parse_file().
+    assert(throws<xmlpp::parse_error>([&]{ parser.parse_file(empty_filename); }));
+    assert(throws<xmlpp::parse_error>([&]{ parser.parse_mapped_file(empty_filename); }));
+    assert(throws<xmlpp::internal_error>([&]{ parser.parse_mapped_file(missing_filename); }));
+
+    // The parser can be used again.
+    parser.parse_mapped_file(filename);
+    assert(parser.get_document()->get_root_node()->get_name2() == "list");
+  }
+
+  // SaxParser.
+  {
+    CountingParser parser;
+    parser.parse_mapped_file(filename);
+    assert(parser.elements == 4);
+    assert(parser.text == "123");
+
+    assert(throws<xmlpp::parse_error>([&]{ parser.parse_mapped_file(empty_filename); }));
+    assert(throws<xmlpp::internal_error>([&]{ parser.parse_mapped_file(missing_filename); }));
+  }
+
+  // TextReader.
+  {
+    xmlpp::TextReader reader(xmlpp::MappedFile{filename});
+    int elements = 0;
+    while (reader.read())
+    {
+      if (reader.get_node_type() == xmlpp::TextReader::NodeType::Element)
+      {
+        ++elements;
+        if (reader.has_attributes())
+          assert(reader.get_attribute2("a") == "x");
+      }
+    }
+    assert(elements == 4);
+
+    xmlpp::TextReader empty_reader(xmlpp::MappedFile{empty_filename});
+    assert(throws<xmlpp::parse_error>([&]{ empty_reader.read(); }));
+  }
+
+  std::remove(filename.c_str());
+  std::remove(empty_filename.c_str());
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml/tree.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+const char* const input =
+  "<root>"
+  "<a id=\"1\"><b id=\"2\">text<c id=\"3\"/></b><!--comment--></a>"
+  "text"
+  "<b id=\"4\"/>"
+  "<a id=\"5\"/>"
+  "</root>";
+
+std::vector<xmlpp::ustring> ids(const xmlpp::NodeRange<const xmlpp::Element*>& range)
+{
+  std::vector<xmlpp::ustring> result;
+  for (const auto element : range)
+    result.push_back(element->get_attribute_value2("id").value_or(""));
+  return result;
+}
+
+std::vector<xmlpp::ustring> ids(const xmlpp::NodeRange<xmlpp::ElementRef>& range)
+{
+  std::vector<xmlpp::ustring> result;
+  for (const auto element : range)
+    result.push_back(element.get_attribute_value2("id").value_or(""));
+  return result;
+}
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser parser;
+  parser.parse_memory(input);
+  auto document = parser.get_document();
+
+  // Ranges of NodeRef create no wrappers.
+  const auto root_ref = document->get_root_node_ref();
+  assert(std::distance(root_ref.children().begin(), root_ref.children().end()) == 4);
+  assert((ids(root_ref.child_elements("a")) == std::vector<xmlpp::ustring>{"1", "5"}));
+  assert(ids(root_ref.child_elements("c")).empty());
+  assert(ids(root_ref.child_elements("nosuchname")).empty());
+  std::vector<xmlpp::ustring> names;
+  for (const auto node : root_ref.descendants())
+    names.push_back(node.get_name2().value_or(""));
+  assert((names == std::vector<xmlpp::ustring>{
+    "a", "b", "text", "c", "comment", "text", "b", "a"}));
+  assert(!document->cobj()->children->_private);
+
+  // The same nodes as get_children().
+  const xmlpp::Element* root = document->get_root_node();
+  const auto list = root->get_children();
+  const auto range = root->children();
+  assert(std::equal(list.begin(), list.end(), range.begin(), range.end()));
+  assert((ids(root->child_elements()) == std::vector<xmlpp::ustring>{"1", "4", "5"}));
+  assert((ids(root->child_elements("b")) == std::vector<xmlpp::ustring>{"4"}));
+
+  std::vector<const xmlpp::Node*> descendants(root->descendants().begin(), root->descendants().end());
+  assert(descendants.size() == 8);
+  assert(descendants[3] == root->get_first_child("a")->get_first_child("b")->get_first_child("c"));
+  assert(dynamic_cast<const xmlpp::CommentNode*>(descendants[4]));
+
+  // Empty ranges.
+  const auto c = static_cast<const xmlpp::Element*>(descendants[3]);
+  assert(c->children().empty() && c->descendants().empty() && c->child_elements().empty());
+  assert(xmlpp::NodeRef().children().empty());
+
+  // A name that is not interned in the document's dictionary.
+  auto root_element = document->get_root_node();
+  root_element->add_child_element("new")->set_attribute("id", "6");
+  root_element->add_child_element("a")->set_attribute("id", "7");
+  assert((ids(root_ref.child_elements("new")) == std::vector<xmlpp::ustring>{"6"}));
+  assert((ids(root->child_elements("a")) == std::vector<xmlpp::ustring>{"1", "5", "7"}));
+
+  // Remove nodes while iterating.
+  auto elements = root_element->child_elements("a");
+  for (auto iter = elements.begin(); iter != elements.end();)
+    xmlpp::Node::remove_node(*iter++);
+  assert((ids(root->child_elements()) == std::vector<xmlpp::ustring>{"4", "6"}));
+
+  return EXIT_SUCCESS;
+}
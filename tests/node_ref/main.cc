@@ -0,0 +1,105 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml/tree.h>
+
+#include <cassert>
+#include <cstdlib>
+
+namespace
+{
+const char* const input =
+  "<!DOCTYPE root [<!ATTLIST item kind CDATA 'plain'>]>\n"
+  "<root xmlns:p=\"urn:p\">"
+  "<item id=\"1\" p:extra=\"x\">first</item>"
+  "<!--comment-->"
+  "<p:item id=\"2\">second<b/></p:item>"
+  "</root>";
+
+bool has_wrappers(const xmlNode* node)
+{
+  for (; node; node = node->next)
+  {
+    if (node->_private || has_wrappers(node->children))
+      return true;
+    for (auto attr = node->type == XML_ELEMENT_NODE ? node->properties : nullptr; attr; attr = attr->next)
+      if (attr->_private)
+        return true;
+  }
+  return false;
+}
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser parser;
+  parser.parse_memory(input);
+  const auto document = parser.get_document();
+
+  const auto root = document->get_root_node_ref();
+  assert(root && root.is_element());
+  assert(root.get_name_view() == "root");
+  assert(!root.get_parent());
+
+  // Navigation.
+  const auto item1 = root.get_first_child_element();
+  assert(item1.get_name2() == xmlpp::ustring("item"));
+  assert(item1.get_parent() == root);
+  assert(item1.get_attribute_value2("id") == xmlpp::ustring("1"));
+  assert(item1.get_attribute_value2("extra", "p") == xmlpp::ustring("x"));
+  assert(!item1.get_attribute_value2("extra"));
+  assert(!item1.get_attribute_value2("id", "nosuchprefix"));
+  // A default value from the DTD.
+  assert(item1.get_attribute_value2("kind") == xmlpp::ustring("plain"));
+  assert(item1.has_child_text());
+  assert(item1.get_first_child_text().get_content_view() == "first");
+  assert(item1.get_first_child_text().get_content2() == xmlpp::ustring("first"));
+  assert(item1.get_first_child_text().is_text());
+  assert(!item1.get_content2());
+  assert(item1.get_content_view().empty());
+
+  const auto comment = item1.get_next_sibling();
+  assert(!comment.is_element() && !comment.as_element());
+  assert(comment.get_content_view() == "comment");
+  assert(comment.get_previous_sibling() == item1);
+
+  const auto item2 = item1.get_next_sibling_element("item");
+  assert(item2 && item2 == comment.get_next_sibling());
+  assert(item2.get_namespace_prefix2() == xmlpp::ustring("p"));
+  assert(item2.get_namespace_uri2() == xmlpp::ustring("urn:p"));
+  assert(!item1.get_namespace_uri2());
+  assert(item2.get_path2() == xmlpp::ustring("/root/p:item"));
+  assert(item2.get_first_child_element("b"));
+  assert(!item2.get_first_child_element("c"));
+  assert(!item2.get_next_sibling_element());
+  assert(root.get_first_child("comment") == comment);
+  assert(!root.get_first_child("nosuchname"));
+  assert(item2.get_line() == 2);
+
+  // NodeRef creates no C++ wrappers.
+  // The xmlDoc refers to the Document.
+  assert(!has_wrappers(document->cobj()->children));
+
+  // Conversion to and from C++ wrappers.
+  const xmlpp::Element* element = item2.get_element();
+  assert(element && element->get_attribute_value2("id") == xmlpp::ustring("2"));
+  assert(xmlpp::ElementRef(element) == item2);
+  assert(xmlpp::NodeRef(document->get_root_node()) == root);
+  assert(!xmlpp::NodeRef().get_node());
+
+  return EXIT_SUCCESS;
+}
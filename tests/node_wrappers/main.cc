@@ -0,0 +1,138 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml/tree.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+namespace
+{
+int n_derived_elements = 0;
+
+// A C++ wrapper with data members, which can't be allocated from
+// the Document's memory pool.
+class DerivedElement : public xmlpp::Element
+{
+public:
+  explicit DerivedElement(xmlNode* node)
+  : xmlpp::Element(node), data_(100, 'x')
+  {
+    ++n_derived_elements;
+  }
+
+  ~DerivedElement() override
+  {
+    --n_derived_elements;
+  }
+
+private:
+  std::string data_;
+};
+} // anonymous namespace
+
+int main()
+{
+  // Wrappers that are removed, and reused.
+  {
+    xmlpp::Document document;
+    auto root = document.create_root_node("root");
+    for (int i = 0; i < 1000; ++i)
+    {
+      auto child = root->add_child_element("child");
+      child->set_attribute("n", std::to_string(i));
+      child->add_child_text("text");
+      if (i % 2)
+        xmlpp::Node::remove_node(child);
+    }
+    assert(root->get_children().size() == 500);
+    assert(root->get_first_child()->get_next_sibling() != nullptr);
+    assert(document.get_root_node() == root);
+  }
+
+  // A wrapper that is replaced by an instance of a derived class.
+  {
+    xmlpp::Document document;
+    auto root = document.create_root_node("root");
+    auto child = root->add_child_element("child");
+    auto cnode = child->cobj();
+    delete child;
+    auto derived = new DerivedElement(cnode);
+    assert(n_derived_elements == 1);
+    assert(root->get_first_child() == derived);
+
+    // Another derived wrapper, that is deleted with its node.
+    auto other = root->add_child_element("other");
+    auto other_cnode = other->cobj();
+    delete other;
+    xmlpp::Node::remove_node(new DerivedElement(other_cnode));
+    assert(n_derived_elements == 1);
+  }
+  assert(n_derived_elements == 0);
+
+  // Wrappers of nodes in an xmlDoc without a Document.
+  {
+    auto doc = xmlNewDoc((const xmlChar*)"1.0");
+    auto root = xmlNewDocNode(doc, nullptr, (const xmlChar*)"root", nullptr);
+    xmlDocSetRootElement(doc, root);
+    xmlNewChild(root, nullptr, (const xmlChar*)"child", nullptr);
+    xmlpp::Node::create_wrapper(root);
+    auto element = static_cast<xmlpp::Element*>(root->_private);
+    assert(element->get_children().size() == 1);
+    xmlpp::Node::free_wrappers(root);
+    assert(!root->_private);
+    xmlFreeDoc(doc);
+  }
+
+  // Wrappers that are created before the xmlDoc gets a Document.
+  // They are deleted by the Document.
+  {
+    auto doc = xmlNewDoc((const xmlChar*)"1.0");
+    auto root = xmlNewDocNode(doc, nullptr, (const xmlChar*)"root", nullptr);
+    xmlDocSetRootElement(doc, root);
+    auto child = xmlNewChild(root, nullptr, (const xmlChar*)"child", nullptr);
+    new DerivedElement(child);
+    assert(n_derived_elements == 1);
+    {
+      xmlpp::Document document(doc);
+      assert(document.get_root_node()->get_first_child() == child->_private);
+    }
+    assert(n_derived_elements == 0);
+  }
+
+  // Wrappers of the nodes of a const Document, created by two threads.
+  {
+    xmlpp::Document document;
+    auto root = document.create_root_node("root");
+    for (int i = 0; i < 1000; ++i)
+      xmlNewChild(root->cobj(), nullptr, (const xmlChar*)"child", nullptr);
+    const xmlpp::Element* const_root = root;
+    auto count_children = [const_root]()
+    {
+      return const_root->get_children().size();
+    };
+    std::size_t n1 = 0;
+    std::thread thread([&n1, &count_children]() { n1 = count_children(); });
+    const auto n2 = count_children();
+    thread.join();
+    assert(n1 == 1000 && n2 == 1000);
+  }
+
+  return EXIT_SUCCESS;
+}
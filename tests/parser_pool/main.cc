@@ -0,0 +1,200 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+class CountingSaxParser : public xmlpp::SaxParser
+{
+public:
+  int n_elements = 0;
+
+protected:
+  void on_start_document() override
+  {
+    n_elements = 0;
+  }
+
+  void on_start_element(const xmlpp::ustring&, const AttributeList&) override
+  {
+    ++n_elements;
+  }
+};
+
+std::string make_document(int n)
+{
+  std::string doc = "<root n=\"" + std::to_string(n) + "\">";
+  for (int i = 0; i < n % 7; ++i)
+    doc += "<item>" + std::to_string(i) + "</item>";
+  doc += "</root>";
+  return doc;
+}
+
+int main()
+{
+  // A DomParser that reuses its context gives the same results as a new one,
+  // also after errors.
+  {
+    xmlpp::DomParser parser;
+    parser.set_reuse_context();
+    assert(parser.get_reuse_context());
+
+    for (int n = 0; n < 20; ++n)
+    {
+      if (n % 5 == 4)
+      {
+        bool thrown = false;
+        try
+        {
+          parser.parse_memory("<root><unclosed></root>");
+        }
+        catch (const xmlpp::parse_error&)
+        {
+          thrown = true;
+        }
+        assert(thrown);
+        continue;
+      }
+
+      parser.parse_memory(make_document(n));
+      const auto root = parser.get_document()->get_root_node();
+      assert(root->get_attribute_value2("n") == std::to_string(n));
+      assert(root->get_children("item").size() == static_cast<std::size_t>(n % 7));
+    }
+
+    // Options still take effect after a change.
+    parser.set_substitute_entities();
+    parser.parse_memory("<!DOCTYPE root [<!ENTITY e \"text\">]><root>&e;</root>");
+    assert(parser.get_document()->get_root_node()->get_first_child_text()->get_content2() == "text");
+    parser.set_substitute_entities(false);
+    parser.parse_memory("<!DOCTYPE root [<!ENTITY e \"text\">]><root>&e;</root>");
+    assert(!parser.get_document()->get_root_node()->get_first_child_text());
+  }
+
+  // A SaxParser that reuses its context.
+  {
+    CountingSaxParser parser;
+    parser.set_reuse_context();
+    for (int n = 0; n < 20; ++n)
+    {
+      parser.parse_memory(make_document(n));
+      assert(parser.n_elements == 1 + n % 7);
+    }
+  }
+
+  // Batches.
+  for (const unsigned int n_threads : { 1u, 2u, 4u })
+  {
+    xmlpp::ParserPool<xmlpp::DomParser> pool(n_threads);
+    assert(pool.get_n_threads() == n_threads);
+
+    std::vector<std::string> documents;
+    for (int n = 0; n < 500; ++n)
+      documents.push_back(n % 50 == 49 ? "<root>" : make_document(n));
+
+    for (int batch = 0; batch < 3; ++batch)
+    {
+      std::vector<std::string> values(documents.size());
+      const auto errors = pool.parse_all(documents,
+        [&values](std::size_t index, xmlpp::DomParser& parser)
+        {
+          values[index] = parser.get_document()->get_root_node()->get_attribute_value2("n").value_or("");
+        });
+
+      assert(errors.size() == documents.size());
+      for (std::size_t n = 0; n < documents.size(); ++n)
+      {
+        if (n % 50 == 49)
+          assert(errors[n] && values[n].empty());
+        else
+          assert(!errors[n] && values[n] == std::to_string(n));
+      }
+    }
+
+    // An empty batch.
+    assert(pool.parse_all(std::vector<std::string>(), [](std::size_t, xmlpp::DomParser&) {}).empty());
+  }
+
+  // A batch of one item starts no workers. The workers that are started by
+  // the next batch must run only that batch.
+  for (int i = 0; i < 100; ++i)
+  {
+    xmlpp::ParserPool<CountingSaxParser> pool(4);
+    std::atomic<int> n_done(0);
+    const auto count = [&n_done](std::size_t, CountingSaxParser&) { ++n_done; };
+
+    pool.parse_all(std::vector<std::string>{ make_document(1) }, count);
+    assert(n_done == 1);
+
+    const std::vector<std::string> documents(40, make_document(3));
+    n_done = 0;
+    pool.parse_all(documents, count);
+    assert(n_done == 40);
+  }
+
+  // SaxParsers created by a factory, and leases from several threads.
+  {
+    xmlpp::ParserPool<CountingSaxParser> pool(3, []
+      {
+        auto parser = std::make_unique<CountingSaxParser>();
+        parser->set_throw_messages();
+        return parser;
+      });
+
+    std::atomic<int> n_elements(0);
+    std::vector<std::string> documents;
+    int expected = 0;
+    for (int n = 0; n < 100; ++n)
+    {
+      documents.push_back(make_document(n));
+      expected += 1 + n % 7;
+    }
+    const auto errors = pool.parse_all(documents,
+      [&n_elements](std::size_t, CountingSaxParser& parser)
+      {
+        assert(parser.get_throw_messages());
+        n_elements += parser.n_elements;
+      });
+    for (const auto& error : errors)
+      assert(!error);
+    assert(n_elements == expected);
+
+    std::vector<std::thread> threads;
+    n_elements = 0;
+    for (int t = 0; t < 4; ++t)
+      threads.emplace_back([&pool, &n_elements, &documents]
+        {
+          for (const auto& document : documents)
+          {
+            auto parser = pool.acquire();
+            assert(parser->get_reuse_context());
+            parser->parse_memory(document);
+            n_elements += parser->n_elements;
+          }
+        });
+    for (auto& thread : threads)
+      thread.join();
+    assert(n_elements == 4 * expected);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,141 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+const char* const document =
+  "<library xmlns:x=\"urn:x\">"
+  "<book id=\"1\"><title>A</title></book>"
+  "<x:book id=\"2\"><x:title>B</x:title><note/></x:book>"
+  "<book id=\"3\"><book id=\"4\"/></book>"
+  "<shelf/>"
+  "</library>";
+
+class DispatchParser : public xmlpp::SaxDispatchParser<DispatchParser>
+{
+public:
+  DispatchParser()
+  : SaxDispatchParser({
+      { "book", &DispatchParser::on_start_book, &DispatchParser::on_end_book },
+      { "title", &DispatchParser::on_start_title, nullptr, "urn:x" },
+      { "title", nullptr, &DispatchParser::on_end_title },
+      { "library", &DispatchParser::on_start_library, nullptr },
+    })
+  {}
+
+  std::string log;
+  std::string throw_at;
+
+protected:
+  void on_start_book(const QName& /* name */, const NsAttributeList& attributes)
+  {
+    std::string id;
+    for (const auto& attribute : attributes)
+      if (attribute.name.local_name.view() == "id")
+        id = attribute.value;
+    if (id == throw_at)
+      throw std::runtime_error("book " + id);
+    log += "<book" + id + ">";
+  }
+
+  void on_end_book(const QName& /* name */)
+  {
+    log += "</book>";
+  }
+
+  void on_start_title(const QName& /* name */, const NsAttributeList& /* attributes */)
+  {
+    log += "<x:title>";
+  }
+
+  void on_end_title(const QName& name)
+  {
+    // The first matching handler wins, and x:title has no end handler.
+    assert(!name.uri);
+    log += "</title>";
+  }
+
+  void on_start_library(const QName& /* name */, const NsAttributeList& /* attributes */)
+  {
+    log += "<library>";
+  }
+
+  // Elements without a handler.
+  void on_start_element(const xmlpp::ustring& name, const AttributeList& /* attributes */) override
+  {
+    log += "[" + name + "]";
+  }
+
+  void on_end_element(const xmlpp::ustring& name) override
+  {
+    log += "[/" + name + "]";
+  }
+};
+} // anonymous namespace
+
+int main()
+{
+  // Handler dispatch, nested elements, and elements without handlers.
+  // library has no end handler, but it's in the table, so its end
+  // is not passed on to on_end_element().
+  {
+    DispatchParser parser;
+    assert(parser.get_namespace_callbacks());
+    parser.parse_memory(document);
+    assert(parser.log ==
+      "<library>"
+      "<book1></title></book>"
+      "<book2><x:title>[note][/note]</book>"
+      "<book3><book4></book></book>"
+      "[shelf][/shelf]");
+
+    // The table is reused in the next parse.
+    parser.log.clear();
+    parser.parse_memory(document);
+    assert(parser.log.find("<book4></book></book>") != std::string::npos);
+  }
+
+  // An exception thrown from a handler stops the parse, and is rethrown.
+  {
+    DispatchParser parser;
+    parser.throw_at = "2";
+    try
+    {
+      parser.parse_memory(document);
+      assert(false);
+    }
+    catch (const std::runtime_error& e)
+    {
+      assert(std::string(e.what()) == "book 2");
+    }
+    assert(parser.log == "<library><book1></title></book>");
+
+    // The parser can be used again.
+    parser.throw_at.clear();
+    parser.log.clear();
+    parser.parse_memory(document);
+    assert(parser.log.find("<book2>") != std::string::npos);
+  }
+
+  return EXIT_SUCCESS;
+}
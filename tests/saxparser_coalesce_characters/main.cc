@@ -0,0 +1,106 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+// The entity references split the text into several pieces.
+const char* const document =
+  "<root>abc&amp;def&lt;ghi<child/>jkl<!--comment-->mno<![CDATA[cdata]]>pqr</root>";
+}
+
+class CharactersParser : public xmlpp::SaxParser
+{
+public:
+  std::vector<std::string> pieces;
+
+protected:
+  void on_characters(const xmlpp::ustring& characters) override
+  {
+    pieces.push_back(characters);
+  }
+};
+
+class CharactersViewParser : public xmlpp::SaxViewParser
+{
+public:
+  std::vector<std::string> pieces;
+
+protected:
+  void on_characters_view(std::string_view characters) override
+  {
+    pieces.emplace_back(characters);
+  }
+};
+
+const std::vector<std::string> expected = { "abc&def<ghi", "jkl", "mno", "pqr" };
+
+void test_not_coalesced()
+{
+  CharactersParser parser;
+  assert(!parser.get_coalesce_characters());
+  parser.parse_memory(document);
+  assert(parser.pieces.size() > expected.size());
+}
+
+void test_coalesced()
+{
+  CharactersParser parser;
+  parser.set_coalesce_characters();
+  assert(parser.get_coalesce_characters());
+  parser.parse_memory(document);
+  assert(parser.pieces == expected);
+
+  // The chunk boundaries split the text, too.
+  parser.pieces.clear();
+  const std::string doc(document);
+  for (std::string::size_type i = 0; i < doc.size(); i += 3)
+    parser.parse_chunk(doc.substr(i, 3));
+  parser.finish_chunk_parsing();
+  assert(parser.pieces == expected);
+}
+
+void test_coalesced_view()
+{
+  CharactersViewParser parser;
+  // The order of the calls shall not matter.
+  parser.set_coalesce_characters();
+  parser.set_string_view_callbacks();
+  assert(parser.get_coalesce_characters());
+  parser.parse_memory(document);
+  assert(parser.pieces == expected);
+
+  parser.pieces.clear();
+  parser.set_coalesce_characters(false);
+  assert(parser.get_string_view_callbacks());
+  parser.parse_memory(document);
+  assert(parser.pieces.size() > expected.size());
+}
+
+int main()
+{
+  test_not_coalesced();
+  test_coalesced();
+  test_coalesced_view();
+
+  return EXIT_SUCCESS;
+}
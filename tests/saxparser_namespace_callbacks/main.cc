@@ -0,0 +1,168 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+const char* const document =
+  "<a:root xmlns:a=\"urn:a\" xmlns=\"urn:default\" a:x=\"1\" y=\"2\">"
+  "<child/><a:child/></a:root>";
+}
+
+class NsParser : public xmlpp::SaxViewParser
+{
+public:
+  NsParser()
+  {
+    set_namespace_callbacks();
+    urn_a_ = intern("urn:a");
+    urn_default_ = intern("urn:default");
+    root_ = intern("root");
+    child_ = intern("child");
+    x_ = intern("x");
+    y_ = intern("y");
+  }
+
+  int a_children = 0;
+  int default_children = 0;
+  int end_elements = 0;
+  bool root_checked = false;
+
+protected:
+  void on_start_element_ns(const QName& name, const NsAttributeList& attributes,
+    const NamespaceList& namespaces) override
+  {
+    if (name.local_name == root_)
+    {
+      assert(name.uri == urn_a_);
+      assert(name.prefix.view() == "a");
+
+      assert(namespaces.size() == 2);
+      assert(namespaces[0].prefix.view() == "a");
+      assert(namespaces[0].uri == urn_a_);
+      assert(!namespaces[1].prefix);
+      assert(namespaces[1].uri == urn_default_);
+
+      assert(attributes.size() == 2);
+      auto x = attributes.find(x_, urn_a_);
+      assert(x != attributes.end());
+      assert((*x).value == "1");
+      assert(!(*x).defaulted);
+      // Unprefixed attributes have no namespace.
+      assert(attributes.find(y_, urn_default_) == attributes.end());
+      auto y = attributes.find(y_);
+      assert(y != attributes.end());
+      assert((*y).value == "2");
+      root_checked = true;
+    }
+    else if (name.local_name == child_)
+    {
+      if (name.uri == urn_a_)
+        ++a_children;
+      else if (name.uri == urn_default_)
+        ++default_children;
+    }
+  }
+
+  void on_end_element_ns(const QName& name) override
+  {
+    assert(name.local_name == root_ || name.local_name == child_);
+    ++end_elements;
+  }
+
+private:
+  InternedName urn_a_;
+  InternedName urn_default_;
+  InternedName root_;
+  InternedName child_;
+  InternedName x_;
+  InternedName y_;
+};
+
+void test_namespace_callbacks()
+{
+  NsParser parser;
+  assert(parser.get_namespace_callbacks());
+
+  // The interned names remain valid in later parses.
+  for (int i = 1; i <= 2; ++i)
+  {
+    parser.parse_memory(document);
+    assert(parser.root_checked);
+    assert(parser.a_children == i);
+    assert(parser.default_children == i);
+    assert(parser.end_elements == 3 * i);
+  }
+
+  // Chunk-wise parsing.
+  parser.parse_chunk(document);
+  parser.finish_chunk_parsing();
+  assert(parser.a_children == 3);
+}
+
+// The default on_*_ns() methods call the SAX1-style methods.
+class ForwardingParser : public xmlpp::SaxViewParser
+{
+public:
+  std::string log;
+
+protected:
+  void on_start_element(const xmlpp::ustring& name, const AttributeList& attributes) override
+  {
+    log += "<" + name;
+    for (const auto& attribute : attributes)
+      log += " " + attribute.name + "=" + attribute.value;
+    log += ">";
+  }
+
+  void on_end_element(const xmlpp::ustring& name) override
+  {
+    log += "</" + name + ">";
+  }
+};
+
+void test_default_forwarding()
+{
+  const std::string expected =
+    "<a:root xmlns:a=urn:a xmlns=urn:default a:x=1 y=2><child></child><a:child></a:child></a:root>";
+
+  ForwardingParser parser;
+  parser.parse_memory(document);
+  assert(parser.log == expected);
+
+  parser.log.clear();
+  parser.set_namespace_callbacks();
+  parser.parse_memory(document);
+  assert(parser.log == expected);
+
+  parser.log.clear();
+  parser.set_string_view_callbacks();
+  parser.parse_memory(document);
+  assert(parser.log == expected);
+}
+
+int main()
+{
+  test_namespace_callbacks();
+  test_default_forwarding();
+
+  return EXIT_SUCCESS;
+}
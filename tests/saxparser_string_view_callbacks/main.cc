@@ -0,0 +1,183 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+const char* const document =
+  "<root a=\"1\" b=\"two\"><child>text</child><!--a comment--><![CDATA[cdata]]></root>";
+}
+
+class ViewParser : public xmlpp::SaxViewParser
+{
+public:
+  std::string log;
+
+protected:
+  void on_start_element_view(std::string_view name, const AttributeViewList& attributes) override
+  {
+    log += "<";
+    log += name;
+    for (const auto& attribute : attributes)
+    {
+      log += " ";
+      log += attribute.name;
+      log += "=";
+      log += attribute.value;
+    }
+    log += ">";
+  }
+
+  void on_end_element_view(std::string_view name) override
+  {
+    log += "</";
+    log += name;
+    log += ">";
+  }
+
+  void on_characters_view(std::string_view characters) override
+  {
+    log += characters;
+  }
+
+  void on_comment_view(std::string_view text) override
+  {
+    log += "#";
+    log += text;
+  }
+
+  void on_cdata_block_view(std::string_view text) override
+  {
+    log += "$";
+    log += text;
+  }
+
+  // Must not be called when the view callbacks are used.
+  void on_start_element(const xmlpp::ustring&, const AttributeList&) override
+  {
+    assert(false);
+  }
+};
+
+void test_view_callbacks()
+{
+  const std::string expected = "<root a=1 b=two><child>text</child>#a comment$cdata</root>";
+
+  ViewParser parser;
+  assert(!parser.get_string_view_callbacks());
+  parser.set_string_view_callbacks();
+  assert(parser.get_string_view_callbacks());
+
+  parser.parse_memory(document);
+  assert(parser.log == expected);
+
+  // Chunk-wise parsing uses a copy of the SAX handler.
+  parser.log.clear();
+  const std::string doc(document);
+  for (std::string::size_type i = 0; i < doc.size(); i += 7)
+    parser.parse_chunk(doc.substr(i, 7));
+  parser.finish_chunk_parsing();
+  assert(parser.log == expected);
+}
+
+class FindAttributeParser : public xmlpp::SaxViewParser
+{
+public:
+  bool found = false;
+
+protected:
+  void on_start_element_view(std::string_view name, const AttributeViewList& attributes) override
+  {
+    if (name != "root")
+      return;
+    assert(attributes.size() == 2);
+    assert(attributes.find("c") == attributes.end());
+    auto it = attributes.find("b");
+    assert(it != attributes.end());
+    assert((*it).value == "two");
+    found = true;
+  }
+};
+
+void test_find_attribute()
+{
+  FindAttributeParser parser;
+  parser.set_string_view_callbacks();
+  parser.parse_memory(document);
+  assert(parser.found);
+}
+
+// Only some on_*_view() methods are overridden. The others
+// shall call the ustring versions.
+class MixedParser : public xmlpp::SaxViewParser
+{
+public:
+  std::string log;
+
+protected:
+  void on_characters_view(std::string_view characters) override
+  {
+    log += characters;
+  }
+
+  void on_start_element(const xmlpp::ustring& name, const AttributeList& attributes) override
+  {
+    log += "<" + name + ":" + std::to_string(attributes.size()) + ">";
+  }
+
+  void on_end_element(const xmlpp::ustring& name) override
+  {
+    log += "</" + name + ">";
+  }
+
+  void on_comment(const xmlpp::ustring& text) override
+  {
+    log += "#" + text;
+  }
+
+  void on_cdata_block(const xmlpp::ustring& text) override
+  {
+    log += "$" + text;
+  }
+};
+
+void test_default_forwarding()
+{
+  MixedParser parser;
+  parser.set_string_view_callbacks();
+  parser.parse_memory(document);
+  assert(parser.log == "<root:2><child:0>text</child>#a comment$cdata</root>");
+
+  // Switched off again, on_characters() is called instead of on_characters_view().
+  parser.log.clear();
+  parser.set_string_view_callbacks(false);
+  parser.parse_memory(document);
+  assert(parser.log == "<root:2><child:0></child>#a comment$cdata</root>");
+}
+
+int main()
+{
+  test_view_callbacks();
+  test_find_attribute();
+  test_default_forwarding();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+const char* const input =
+  "<!DOCTYPE feed [<!ENTITY e \"<p:em>ent</p:em>ity\">]>\n"
+  "<feed xmlns=\"urn:feed\" xmlns:p=\"urn:p\">\n"
+  "<title>Feed</title>\n"
+  "<entry type=\"x\" p:rank=\"1\"><id>1</id><p:link href=\"a\"/>text<![CDATA[ & more]]><!--c--></entry>\n"
+  "<entry type=\"y\"><id>2</id><entry><id>3</id><?pi data?>&e;</entry></entry>\n"
+  "</feed>";
+
+class EntryParser : public xmlpp::SaxSubtreeParser
+{
+public:
+  EntryParser()
+  : SaxSubtreeParser("/f:feed/f:entry | //f:entry/f:entry", { { "f", "urn:feed" } })
+  {}
+
+  std::vector<std::unique_ptr<xmlpp::Document>> documents;
+  std::string outside;
+
+protected:
+  void on_subtree(std::unique_ptr<xmlpp::Document> document) override
+  {
+    documents.push_back(std::move(document));
+  }
+
+  void on_start_element(const xmlpp::ustring& name, const AttributeList& /* attributes */) override
+  {
+    outside += "<" + name + ">";
+  }
+
+  void on_characters(const xmlpp::ustring& characters) override
+  {
+    if (characters != "\n")
+      outside += characters;
+  }
+};
+} // anonymous namespace
+
+int main()
+{
+  EntryParser parser;
+  parser.parse_memory(input);
+
+  // The events outside of the subtrees are passed on.
+  assert(parser.outside == "<feed><title>Feed");
+
+  // A nested match is part of its ancestor's subtree.
+  assert(parser.documents.size() == 2);
+  const xmlpp::Node::PrefixNsMap namespaces = { { "f", "urn:feed" }, { "p", "urn:p" } };
+
+  auto entry = parser.documents[0]->get_root_node();
+  assert(entry->get_name2() == "entry");
+  assert(entry->get_namespace_uri2() == "urn:feed");
+  assert(entry->get_line() == 4);
+  assert(entry->eval_to_string("f:id", namespaces) == "1");
+  assert(entry->eval_to_string("@type", namespaces) == "x");
+  assert(entry->eval_to_string("@p:rank", namespaces) == "1");
+  assert(entry->eval_to_string("p:link/@href", namespaces) == "a");
+  assert(entry->eval_to_string("string(text())", namespaces) == "text");
+  assert(entry->eval_to_string(".", namespaces) == "1text & more");
+  assert(entry->count("comment()") == 1);
+  // The namespaces declared outside of the subtree are declared on its root.
+  const auto xml = parser.documents[0]->write_to_string();
+  assert(xml.find("<entry xmlns=\"urn:feed\"") != xmlpp::ustring::npos);
+  assert(xml.find("xmlns:p=\"urn:p\"") != xmlpp::ustring::npos);
+
+  entry = parser.documents[1]->get_root_node();
+  assert(entry->count("//f:id", namespaces) == 2);
+  assert(entry->eval_to_string("f:entry/f:id", namespaces) == "3");
+  // Processing instructions and the content of entity references are added.
+  assert(entry->eval_to_string("f:entry/processing-instruction('pi')", namespaces) == "data");
+  assert(entry->eval_to_string("f:entry/p:em", namespaces) == "ent");
+  assert(entry->eval_to_string("f:entry/text()", namespaces) == "ity");
+  // A namespace that is first used in a nested element is also declared on the root.
+  const auto xml1 = parser.documents[1]->write_to_string();
+  assert(xml1.find("<entry xmlns=\"urn:feed\" xmlns:p=\"urn:p\" type=\"y\">") != xmlpp::ustring::npos);
+  assert(xml1.find("<p:em>") != xmlpp::ustring::npos);
+
+  // A second parse.
+  parser.documents.clear();
+  parser.outside.clear();
+  parser.parse_memory(input);
+  assert(parser.documents.size() == 2);
+  assert(parser.outside == "<feed><title>Feed");
+
+  // An error in a subtree.
+  parser.documents.clear();
+  try
+  {
+    parser.parse_memory("<feed xmlns=\"urn:feed\"><entry><id>1</id></feed>");
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+  assert(parser.documents.empty());
+  parser.parse_memory(input);
+  assert(parser.documents.size() == 2);
+
+  return EXIT_SUCCESS;
+}
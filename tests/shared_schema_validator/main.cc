@@ -0,0 +1,206 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const char xsd_text[] =
+  "<xs:schema xmlns:xs='http://www.w3.org/2001/XMLSchema'>"
+  "<xs:element name='list'><xs:complexType><xs:sequence>"
+  "<xs:element name='item' type='xs:int' maxOccurs='unbounded'/>"
+  "</xs:sequence></xs:complexType></xs:element>"
+  "</xs:schema>";
+
+const char relaxng_text[] =
+  "<element name='list' xmlns='http://relaxng.org/ns/structure/1.0'"
+  " datatypeLibrary='http://www.w3.org/2001/XMLSchema-datatypes'>"
+  "<oneOrMore><element name='item'><data type='int'/></element></oneOrMore>"
+  "</element>";
+
+const char dtd_text[] =
+  "<!ELEMENT list (item+)>"
+  "<!ELEMENT item (#PCDATA)>";
+
+// Valid in all schemas, except for every 10th document, which has an
+// element that is not declared.
+std::string make_document(int n)
+{
+  std::string doc = "<list>";
+  for (int i = 0; i < n % 5 + 1; ++i)
+    doc += "<item>" + std::to_string(i) + "</item>";
+  if (n % 10 == 9)
+    doc += "<other/>";
+  doc += "</list>";
+  return doc;
+}
+
+template <typename Exception, typename F>
+bool throws(F f, std::string* message = nullptr)
+{
+  try
+  {
+    f();
+  }
+  catch (const Exception& ex)
+  {
+    if (message)
+      *message = ex.what();
+    return true;
+  }
+  return false;
+}
+
+// Validate documents from several threads at once.
+void test_threads(const xmlpp::SharedSchemaValidator& validator)
+{
+  const int n_threads = 4;
+  const int n_documents = 200;
+
+  std::vector<std::unique_ptr<xmlpp::DomParser>> parsers;
+  for (int n = 0; n < n_documents; ++n)
+    parsers.push_back(std::make_unique<xmlpp::DomParser>());
+  for (int n = 0; n < n_documents; ++n)
+    parsers[n]->parse_memory(make_document(n));
+
+  std::atomic<int> n_valid(0);
+  std::atomic<int> n_invalid(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < n_threads; ++t)
+    threads.emplace_back([&, t]
+    {
+      for (int n = t; n < n_documents; n += n_threads)
+      {
+        try
+        {
+          validator.validate(parsers[n]->get_document());
+          ++n_valid;
+        }
+        catch (const xmlpp::validity_error&)
+        {
+          ++n_invalid;
+        }
+      }
+    });
+  for (auto& thread : threads)
+    thread.join();
+
+  assert(n_valid == n_documents - n_documents / 10);
+  assert(n_invalid == n_documents / 10);
+  assert(validator.get_n_contexts() >= 1);
+  assert(validator.get_n_contexts() <= static_cast<std::size_t>(n_threads));
+}
+
+void test_files(const xmlpp::SharedSchemaValidator& validator)
+{
+  const std::string valid_file = "shared_schema_validator_valid.xml";
+  const std::string invalid_file = "shared_schema_validator_invalid.xml";
+  const std::string malformed_file = "shared_schema_validator_malformed.xml";
+  std::ofstream(valid_file) << make_document(1);
+  std::ofstream(invalid_file) << make_document(9);
+  std::ofstream(malformed_file) << "<list><item>1</item>";
+
+  validator.validate(valid_file);
+  assert(throws<xmlpp::validity_error>([&]{ validator.validate(invalid_file); }));
+  assert(throws<xmlpp::parse_error>([&]{ validator.validate(malformed_file); }));
+  std::string message;
+  assert(throws<xmlpp::parse_error>([&]{ validator.validate(std::string("no_such_file.xml")); },
+    &message));
+  assert(message.find("no_such_file.xml") != std::string::npos);
+  validator.validate(valid_file);
+
+  std::remove(valid_file.c_str());
+  std::remove(invalid_file.c_str());
+  std::remove(malformed_file.c_str());
+}
+} // anonymous namespace
+
+int main()
+{
+  // XSD
+  {
+    auto schema = std::make_shared<xmlpp::XsdSchema>();
+    schema->parse_memory(xsd_text);
+    const xmlpp::SharedSchemaValidator validator(schema);
+    assert(validator.get_n_contexts() == 0);
+
+    xmlpp::DomParser parser;
+    parser.parse_memory(make_document(0));
+    validator.validate(parser.get_document());
+    assert(validator.get_n_contexts() == 1);
+    parser.parse_memory(make_document(9));
+    assert(throws<xmlpp::validity_error>([&]{ validator.validate(parser.get_document()); }));
+    assert(validator.get_n_contexts() == 1);
+
+    test_threads(validator);
+    test_files(validator);
+
+    // Like SharedSchemaValidator, XsdValidator names a file that can't be read.
+    xmlpp::XsdValidator xsd_validator(schema.get(), false);
+    std::string message;
+    assert(throws<xmlpp::validity_error>([&]{ xsd_validator.validate(std::string("no_such_file.xml")); },
+      &message));
+    assert(message.find("no_such_file.xml") != std::string::npos);
+
+    // The validator keeps the schema alive.
+    schema.reset();
+    parser.parse_memory(make_document(0));
+    validator.validate(parser.get_document());
+  }
+
+  // RelaxNG
+  {
+    auto schema = std::make_shared<xmlpp::RelaxNGSchema>();
+    schema->parse_memory(relaxng_text);
+    const xmlpp::SharedSchemaValidator validator(std::move(schema));
+    test_threads(validator);
+    test_files(validator);
+  }
+
+  // DTD
+  {
+    auto dtd = std::make_shared<xmlpp::Dtd>();
+    dtd->parse_memory(dtd_text);
+    const xmlpp::SharedSchemaValidator validator(std::move(dtd));
+    test_threads(validator);
+    test_files(validator);
+  }
+
+  // Unparsed schemas.
+  assert(throws<xmlpp::internal_error>([]
+    { xmlpp::SharedSchemaValidator(std::make_shared<const xmlpp::XsdSchema>()); }));
+  assert(throws<xmlpp::internal_error>([]
+    { xmlpp::SharedSchemaValidator(std::shared_ptr<const xmlpp::Dtd>()); }));
+
+  assert(throws<xmlpp::internal_error>([]
+    {
+      auto schema = std::make_shared<xmlpp::XsdSchema>();
+      schema->parse_memory(xsd_text);
+      xmlpp::SharedSchemaValidator(schema).validate(static_cast<const xmlpp::Document*>(nullptr));
+    }));
+
+  return EXIT_SUCCESS;
+}
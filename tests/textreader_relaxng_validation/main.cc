@@ -0,0 +1,121 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+const char schema_text[] =
+  "<element name='list' xmlns='http://relaxng.org/ns/structure/1.0'>"
+  "<oneOrMore><element name='item'><attribute name='id'/><text/></element></oneOrMore>"
+  "</element>";
+
+// Count the elements that are read while the document is valid.
+int read_valid_elements(const std::string& doc, const xmlpp::RelaxNGSchema& schema, bool& valid)
+{
+  xmlpp::TextReader reader((const unsigned char*)doc.data(), doc.size());
+  reader.set_schema(&schema);
+  int elements = 0;
+  while (reader.read() && reader.is_valid())
+    if (reader.get_node_type() == xmlpp::TextReader::NodeType::Element)
+      ++elements;
+  valid = reader.is_valid();
+  return elements;
+}
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::RelaxNGSchema schema;
+  schema.parse_memory(schema_text);
+
+  const int n_items = 100000;
+  std::string valid_doc = "<list>";
+  for (int i = 0; i < n_items; ++i)
+    valid_doc += "<item id='" + std::to_string(i) + "'>x</item>";
+  valid_doc += "</list>";
+
+  bool valid = false;
+  assert(read_valid_elements(valid_doc, schema, valid) == n_items + 1);
+  assert(valid);
+
+  // The second item has no id attribute. Reading stops long before the end.
+  std::string invalid_doc = valid_doc;
+  invalid_doc.replace(invalid_doc.find("<item id='1'>"), 13, "<item>");
+  assert(read_valid_elements(invalid_doc, schema, valid) < 1000);
+  assert(!valid);
+
+  // The error is thrown by the next method that checks for errors.
+  {
+    xmlpp::TextReader reader((const unsigned char*)invalid_doc.data(), invalid_doc.size());
+    reader.set_schema(&schema);
+    bool thrown = false;
+    try
+    {
+      while (reader.read())
+        reader.get_name2();
+    }
+    catch (const xmlpp::validity_error&)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+
+    // Too late to set a schema.
+    thrown = false;
+    try
+    {
+      reader.set_schema(&schema);
+    }
+    catch (const xmlpp::internal_error&)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+
+  // Without a schema, nothing is validated.
+  {
+    xmlpp::TextReader reader((const unsigned char*)invalid_doc.data(), invalid_doc.size());
+    reader.set_schema(&schema);
+    reader.set_schema(static_cast<const xmlpp::RelaxNGSchema*>(nullptr));
+    while (reader.read())
+      reader.get_name2();
+  }
+  {
+    xmlpp::TextReader reader((const unsigned char*)invalid_doc.data(), invalid_doc.size());
+    reader.set_schema(&schema);
+    reader.set_schema(nullptr);
+    while (reader.read())
+      reader.get_name2();
+  }
+
+  // The schema can be removed while reading, before the invalid item.
+  {
+    xmlpp::TextReader reader((const unsigned char*)invalid_doc.data(), invalid_doc.size());
+    reader.set_schema(&schema);
+    assert(reader.read() && reader.get_name2() == "list");
+    reader.set_schema(nullptr);
+    while (reader.read())
+      reader.get_name2();
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+const char xsd_text[] =
+  "<xs:schema xmlns:xs='http://www.w3.org/2001/XMLSchema'>"
+  "<xs:element name='records'><xs:complexType><xs:sequence>"
+  "<xs:element ref='record' maxOccurs='unbounded'/>"
+  "</xs:sequence></xs:complexType></xs:element>"
+  "<xs:element name='record'><xs:complexType><xs:sequence>"
+  "<xs:element name='value' type='xs:int'/>"
+  "</xs:sequence></xs:complexType></xs:element>"
+  "</xs:schema>";
+
+const char dtd_text[] =
+  "<!ELEMENT records (record+)>"
+  "<!ELEMENT record (value)>"
+  "<!ELEMENT value (#PCDATA)>";
+
+// The second record is not valid.
+const char document_text[] =
+  "<records>"
+  "<record><value>1</value></record>"
+  "<record><value>x</value><value>2</value></record>"
+  "<record><value>3</value></record>"
+  "</records>";
+
+template <typename Exception, typename F>
+bool throws(F f)
+{
+  try
+  {
+    f();
+  }
+  catch (const Exception&)
+  {
+    return true;
+  }
+  return false;
+}
+
+template <typename Validator>
+void test_subtrees(Validator& validator, xmlpp::Document* document)
+{
+  auto root = document->get_root_node();
+  std::vector<xmlpp::Element*> records;
+  for (auto record : root->child_elements("record"))
+    records.push_back(record);
+  assert(records.size() == 3);
+  auto first = records[0];
+  auto second = records[1];
+  auto third = records[2];
+
+  assert(throws<xmlpp::validity_error>([&]{ validator.validate(document); }));
+  assert(throws<xmlpp::validity_error>([&]{ validator.validate(root); }));
+  validator.validate(first);
+  assert(throws<xmlpp::validity_error>([&]{ validator.validate(second); }));
+  validator.validate(third);
+
+  // Fix the invalid record, and validate only that record.
+  xmlpp::Node::remove_node(*second->child_elements("value").begin());
+  validator.validate(second);
+  validator.validate(document);
+
+  // Break a valid record.
+  first->add_child_element("other");
+  assert(throws<xmlpp::validity_error>([&]{ validator.validate(first); }));
+  validator.validate(second);
+
+  assert(throws<xmlpp::internal_error>([&]
+    { validator.validate(static_cast<const xmlpp::Element*>(nullptr)); }));
+}
+} // anonymous namespace
+
+int main()
+{
+  // XSD
+  {
+    xmlpp::XsdValidator validator;
+    validator.parse_memory(xsd_text);
+    xmlpp::DomParser parser;
+    parser.parse_memory(document_text);
+    test_subtrees(validator, parser.get_document());
+
+    // An element without a global declaration.
+    auto record = *parser.get_document()->get_root_node()->child_elements("record").begin();
+    auto value = *record->child_elements("value").begin();
+    assert(throws<xmlpp::validity_error>([&]{ validator.validate(value); }));
+  }
+
+  // DTD
+  {
+    xmlpp::DtdValidator validator;
+    validator.parse_memory(dtd_text);
+    xmlpp::DomParser parser;
+    parser.parse_memory(document_text);
+    test_subtrees(validator, parser.get_document());
+
+    // The document's own DTD is not changed.
+    assert(!parser.get_document()->get_internal_subset());
+  }
+
+  return EXIT_SUCCESS;
+}
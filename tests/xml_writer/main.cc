@@ -0,0 +1,163 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+namespace
+{
+void write_records(xmlpp::XmlWriter& writer)
+{
+  writer.start_document();
+  {
+    auto records = writer.element_scope("records", { { "count", "2" } });
+    for (const xmlpp::ustring id : { "1", "2" })
+    {
+      auto record = writer.element_scope("record", { { "id", id } });
+      writer.write_element("name", "A & B <" + id + ">");
+    }
+    writer.start_element("empty");
+    writer.end_element();
+  }
+  writer.end_document();
+}
+} // anonymous namespace
+
+int main()
+{
+  // Escaping, attributes and ElementScope.
+  {
+    std::ostringstream output;
+    {
+      xmlpp::XmlWriter writer(output);
+      write_records(writer);
+    }
+    assert(output.str() ==
+      "<?xml version=\"1.0\"?>\n"
+      "<records count=\"2\"><record id=\"1\"><name>A &amp; B &lt;1&gt;</name></record>"
+      "<record id=\"2\"><name>A &amp; B &lt;2&gt;</name></record><empty/></records>\n");
+
+    // The output is well-formed, and equal to what was written.
+    xmlpp::DomParser parser;
+    parser.parse_memory(output.str());
+    const auto root = parser.get_document()->get_root_node();
+    assert(root->get_name2() == "records");
+    assert(root->get_attribute_value2("count") == "2");
+    const auto names = root->find("record/name");
+    assert(names.size() == 2);
+    assert(dynamic_cast<const xmlpp::Element*>(names[1])->get_first_child_text()->get_content2() ==
+      "A & B <2>");
+  }
+
+  // An Attribute owns its name and value, so it may outlive the strings
+  // it was created from.
+  {
+    std::ostringstream output;
+    {
+      xmlpp::XmlWriter writer(output);
+      const xmlpp::XmlWriter::Attribute attribute(std::string("na") + "me", std::to_string(42));
+      writer.start_document();
+      writer.start_element("a");
+      writer.write_attributes({ attribute });
+      writer.end_document();
+    }
+    assert(output.str() == "<?xml version=\"1.0\"?>\n<a name=\"42\"/>\n");
+  }
+
+  // Indentation.
+  {
+    std::ostringstream output;
+    {
+      xmlpp::XmlWriter writer(output);
+      writer.set_indent(true, " ");
+      writer.start_document();
+      writer.start_element("a");
+      writer.write_element("b", "text");
+      writer.start_element("c");
+      writer.write_attribute("x", "\"y\"");
+      writer.end_document();
+    }
+    assert(output.str() ==
+      "<?xml version=\"1.0\"?>\n"
+      "<a>\n <b>text</b>\n <c x=\"&quot;y&quot;\"/>\n</a>\n");
+  }
+
+  // Namespaces, comments, processing instructions and CDATA.
+  {
+    std::ostringstream output;
+    {
+      xmlpp::XmlWriter writer(output);
+      writer.start_document("1.0", "", "yes");
+      writer.write_comment(" c ");
+      writer.write_processing_instruction("pi", "data");
+      writer.start_element_ns("p", "root", "urn:test");
+      writer.write_attribute_ns("q", "attr", "urn:other", "v");
+      writer.write_cdata("<&>");
+      writer.write_raw("<raw/>");
+      writer.write_text("&");
+      writer.end_document();
+    }
+    assert(output.str() ==
+      "<?xml version=\"1.0\" standalone=\"yes\"?>\n"
+      "<!-- c --><?pi data?>"
+      "<p:root q:attr=\"v\" xmlns:q=\"urn:other\" xmlns:p=\"urn:test\">"
+      "<![CDATA[<&>]]><raw/>&amp;</p:root>\n");
+
+    xmlpp::DomParser parser;
+    parser.parse_memory(output.str());
+    const auto root = parser.get_document()->get_root_node();
+    assert(root->get_namespace_uri2() == "urn:test");
+    assert(root->get_attribute_value2("attr", "q") == "v");
+  }
+
+  // Encoding.
+  {
+    std::ostringstream output;
+    {
+      xmlpp::XmlWriter writer(output);
+      writer.start_document("1.0", "ISO-8859-1");
+      writer.write_element("a", "\xC3\xA9"); // U+00E9 in UTF-8
+      writer.end_document();
+    }
+    assert(output.str() ==
+      "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n<a>\xE9</a>\n");
+  }
+
+  // A failed write to the stream.
+  {
+    std::ostringstream output;
+    output.setstate(std::ios_base::badbit);
+    xmlpp::XmlWriter writer(output);
+    writer.start_document();
+    writer.start_element("a");
+    bool thrown = false;
+    try
+    {
+      writer.end_document();
+    }
+    catch (const xmlpp::exception&)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml/tree.h>
+
+#include <cassert>
+#include <cstdlib>
+
+namespace
+{
+const char* const input =
+  "<root xmlns:p=\"urn:p\">"
+  "<a id=\"1\"><b id=\"2\"/></a>"
+  "<p:b id=\"3\"/>"
+  "<b id=\"4\"/>"
+  "</root>";
+
+bool has_wrappers(const xmlNode* node)
+{
+  for (; node; node = node->next)
+  {
+    if (node->_private || has_wrappers(node->children))
+      return true;
+    for (auto attr = node->type == XML_ELEMENT_NODE ? node->properties : nullptr; attr; attr = attr->next)
+      if (attr->_private)
+        return true;
+  }
+  return false;
+}
+
+xmlpp::ustring get_id(const xmlpp::Node* node)
+{
+  return static_cast<const xmlpp::Element*>(node)->get_attribute_value2("id").value_or("");
+}
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser parser;
+  parser.parse_memory(input);
+  auto document = parser.get_document();
+  const xmlpp::NodeRef root(document->cobj()->children);
+
+  // Without wrappers, except for the context node.
+  {
+    const xmlpp::Node* root_node = root.get_node();
+    assert(root_node->exists("//b"));
+    assert(!root_node->exists("//c"));
+    assert(root_node->exists("count(//b) = 2"));
+    assert(root_node->exists("//p:b", { { "p", "urn:p" } }));
+    assert(root_node->count("//b") == 2);
+    assert(root_node->count("//b | //a") == 3);
+    assert(root_node->count("//c") == 0);
+    assert(root_node->count("//x:b", { { "x", "urn:p" } }) == 1);
+
+    xmlpp::XPathContext context;
+    const xmlpp::XPathExpression ids("//@id");
+    assert(root_node->exists(ids, context));
+    assert(root_node->count(ids, context) == 4);
+    context.set_variable_string("id", "4");
+    assert(root_node->exists(xmlpp::XPathExpression("b[@id = $id]"), context));
+    context.set_variable_string("id", "2");
+    assert(!root_node->exists(xmlpp::XPathExpression("b[@id = $id]"), context));
+
+    try
+    {
+      root_node->count("count(//b)");
+      assert(false);
+    }
+    catch (const xmlpp::internal_error&)
+    {
+    }
+    try
+    {
+      root_node->exists("//b[");
+      assert(false);
+    }
+    catch (const xmlpp::exception&)
+    {
+    }
+  }
+  // Only the context node has a wrapper.
+  assert(!has_wrappers(root.cobj()->children));
+
+  // The first node in document order.
+  auto root_node = document->get_root_node();
+  assert(get_id(root_node->find_first("//b")) == "2");
+  assert(get_id(root_node->find_first("//b | //a")) == "1");
+  assert(get_id(root_node->find_first("(//b)[last()]")) == "4");
+  assert(get_id(root_node->find_first("//p:b", { { "p", "urn:p" } })) == "3");
+  assert(!root_node->find_first("//c"));
+  const xmlpp::Node* b = root_node->find_first("a/b");
+  assert(get_id(b->find_first("ancestor::*")) == "");
+  assert(b->find_first("ancestor::*") == root_node);
+
+  xmlpp::XPathContext context;
+  const xmlpp::XPathExpression b_expr("b");
+  assert(get_id(root_node->find_first(b_expr, context)) == "4");
+  assert(root_node->find_first(b_expr, context) == root_node->find(b_expr, context).at(0));
+  assert(!b->find_first(b_expr, context));
+
+  try
+  {
+    root_node->find_first("count(//b)");
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  return EXIT_SUCCESS;
+}
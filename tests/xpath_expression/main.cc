@@ -0,0 +1,117 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <utility>
+
+namespace
+{
+const char* const input1 =
+  "<root xmlns:p=\"urn:p\">"
+  "<list><item id=\"1\"/><item/><p:item id=\"2\"/></list>"
+  "<list><item id=\"3\"/></list>"
+  "</root>";
+
+const char* const input2 =
+  "<root xmlns:q=\"urn:p\"><list><q:item id=\"4\"/><item id=\"5\"/></list></root>";
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser parser1;
+  parser1.parse_memory(input1);
+  xmlpp::DomParser parser2;
+  parser2.parse_memory(input2);
+  auto root1 = parser1.get_document()->get_root_node();
+  const auto root2 = parser2.get_document()->get_root_node();
+
+  try
+  {
+    xmlpp::XPathExpression bad("item[");
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  // One expression and one context, used with different nodes and documents.
+  const xmlpp::XPathExpression items("item[@id]");
+  assert(items.get_expression() == "item[@id]");
+  xmlpp::XPathContext context;
+  std::size_t n_items = 0;
+  for (auto list : root1->child_elements("list"))
+    n_items += list->find(items, context).size();
+  assert(n_items == 2);
+  const auto set = root2->get_first_child()->find(items, context);
+  assert(set.size() == 1 && static_cast<const xmlpp::Element*>(set[0])->get_attribute_value2("id") == "5");
+
+  // Namespaces are resolved by the context.
+  const xmlpp::XPathExpression ns_items("//x:item/@id");
+  try
+  {
+    root1->find(ns_items, context);
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+  context.register_namespace("x", "urn:p");
+  assert(root1->find(ns_items, context).size() == 1);
+  assert(root2->eval_to_string(ns_items, context) == "4");
+  xmlpp::XPathContext ns_context(xmlpp::Node::PrefixNsMap{{"x", "urn:p"}});
+  assert(root2->find(ns_items, ns_context).size() == 1);
+
+  // Other result types.
+  xmlpp::XPathExpression count("count(//item)");
+  xmlpp::XPathResultType result_type = xmlpp::XPathResultType::UNDEFINED;
+  assert(root1->eval_to_number(count, context, &result_type) == 3.0);
+  assert(result_type == xmlpp::XPathResultType::NUMBER);
+  assert(root2->eval_to_boolean(count, context));
+  assert(root1->eval_to_string(count, context) == "3");
+  auto var = root1->eval_xpath(count, context);
+  assert(std::get<double>(var) == 3.0);
+  const auto var2 = std::as_const(*root1).eval_xpath(items, context);
+  assert(std::get<xmlpp::Node::const_NodeSet>(var2).empty());
+
+  try
+  {
+    root1->find(count, context);
+    assert(false);
+  }
+  catch (const xmlpp::internal_error&)
+  {
+  }
+
+  try
+  {
+    root1->eval_to_number(xmlpp::XPathExpression("nosuchfunction()"), context, &result_type);
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+    assert(result_type == xmlpp::XPathResultType::UNDEFINED);
+  }
+
+  // An expression can be moved.
+  xmlpp::XPathExpression moved(std::move(count));
+  count = std::move(moved);
+  assert(root2->eval_to_number(count, context) == 1.0);
+
+  return EXIT_SUCCESS;
+}
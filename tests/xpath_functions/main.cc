@@ -0,0 +1,120 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <set>
+#include <stdexcept>
+
+namespace
+{
+const char* const input =
+  "<orders>"
+  "<order id=\"a1\" date=\"2025-12-30\"/>"
+  "<order id=\"b2\" date=\"2026-01-15\"/>"
+  "<order id=\"c3\" date=\"2026-03-01\"/>"
+  "</orders>";
+
+using Value = xmlpp::XPathContext::Value;
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser parser;
+  parser.parse_memory(input);
+  const xmlpp::Node* root = parser.get_document()->get_root_node();
+
+  xmlpp::XPathContext context;
+  context.register_namespace("my", "urn:my");
+
+  // Set membership.
+  const std::set<xmlpp::ustring> known = { "a1", "c3" };
+  context.register_function("known", "urn:my", [&known](const std::vector<Value>& args) -> Value
+  {
+    assert(args.size() == 1);
+    return known.count(std::get<xmlpp::ustring>(args[0])) != 0;
+  });
+  const xmlpp::XPathExpression known_orders("order[my:known(string(@id))]");
+  auto set = root->find(known_orders, context);
+  assert(set.size() == 2);
+
+  // A range check, with typed arguments and a function without namespace.
+  context.register_function("in-year", [](const std::vector<Value>& args) -> Value
+  {
+    const auto& date = std::get<xmlpp::ustring>(args.at(0));
+    const double year = std::get<double>(args.at(1));
+    return std::stod(date.substr(0, 4)) == year;
+  });
+  context.set_variable_number("year", 2026);
+  assert(root->eval_to_number(xmlpp::XPathExpression("count(order[in-year(string(@date), $year)])"),
+    context) == 2.0);
+
+  // Node-set arguments and results.
+  context.register_function("last-of", "urn:my", [](const std::vector<Value>& args) -> Value
+  {
+    const auto& nodes = std::get<xmlpp::Node::const_NodeSet>(args.at(0));
+    if (nodes.empty())
+      return xmlpp::Node::const_NodeSet();
+    return xmlpp::Node::const_NodeSet{nodes.back(), nodes.front()};
+  });
+  set = root->find(xmlpp::XPathExpression("my:last-of(order)/@id"), context);
+  assert(set.size() == 2);
+  assert(static_cast<const xmlpp::AttributeNode*>(set[0])->get_value() == "a1");
+  assert(root->eval_to_string(xmlpp::XPathExpression("my:last-of(order)[last()]/@id"), context) == "c3");
+  assert(root->find(xmlpp::XPathExpression("my:last-of(nosuchnode)"), context).empty());
+
+  // An exception from a function is rethrown.
+  context.register_function("fail", [](const std::vector<Value>&) -> Value
+  {
+    throw std::runtime_error("fail() called");
+  });
+  try
+  {
+    root->find(xmlpp::XPathExpression("order[fail()]"), context);
+    assert(false);
+  }
+  catch (const std::runtime_error& ex)
+  {
+    assert(std::string(ex.what()) == "fail() called");
+  }
+  assert(root->find(known_orders, context).size() == 2);
+
+  // A compiled expression in a context without the function.
+  xmlpp::XPathContext other_context;
+  other_context.register_namespace("my", "urn:my");
+  try
+  {
+    root->find(known_orders, other_context);
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  context.unregister_function("known", "urn:my");
+  try
+  {
+    root->find(xmlpp::XPathExpression("order[my:known(string(@id))]"), context);
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml/tree.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+const char* const input =
+  "<root xmlns:p=\"urn:p\">"
+  "<a id=\"1\"><b id=\"2\"/></a>"
+  "<p:b id=\"3\"/>"
+  "<b id=\"4\">text</b>"
+  "</root>";
+
+bool has_wrappers(const xmlNode* node)
+{
+  for (; node; node = node->next)
+  {
+    if (node->_private || has_wrappers(node->children))
+      return true;
+    for (auto attr = node->type == XML_ELEMENT_NODE ? node->properties : nullptr; attr; attr = attr->next)
+      if (attr->_private)
+        return true;
+  }
+  return false;
+}
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser parser;
+  parser.parse_memory(input);
+  auto document = parser.get_document();
+  const xmlpp::NodeRef root(document->cobj()->children);
+  xmlpp::Node* root_node = const_cast<xmlpp::Node*>(root.get_node());
+
+  // NodeRefs: no wrappers, except for the context node.
+  {
+    xmlpp::XPathNodeSet<xmlpp::ElementRef> elements(root_node->select("//*[@id]"));
+    assert(elements.size() == 4);
+    assert(!elements.empty());
+    xmlpp::ustring ids;
+    for (auto element : elements)
+      ids += *element.get_attribute_value2("id");
+    assert(ids == "1234");
+    assert(elements[2].get_namespace_prefix2() == "p");
+    assert(elements.end() - elements.begin() == 4);
+    assert(std::find(elements.begin(), elements.end(),
+      xmlpp::ElementRef(root.cobj()->children)) == elements.begin());
+
+    xmlpp::XPathContext context(xmlpp::Node::PrefixNsMap{ { "x", "urn:p" } });
+    const xmlpp::XPathExpression expr("//x:b | //text()");
+    const xmlpp::XPathNodeSet<xmlpp::NodeRef> nodes(root_node->select(expr, context));
+    assert(nodes.size() == 2);
+    assert(nodes[0].get_name_view() == "b");
+    assert(nodes[1].is_text());
+    assert(nodes.begin().cobj() == nodes[0].cobj());
+
+    // Namespace nodes are left out.
+    assert(root_node->select("namespace::*").empty());
+    assert(root_node->select("namespace::* | a").size() == 1);
+    assert(root_node->select("//c").empty());
+  }
+  assert(!has_wrappers(root.cobj()->children));
+
+  // Wrappers are created only for the accessed nodes.
+  auto nodes = root_node->select("//b");
+  assert(nodes.size() == 2);
+  xmlpp::Node* b = nodes[1];
+  assert(b->get_name2() == "b");
+  assert(b->cobj()->_private == b);
+  assert(!nodes.get(0)->_private);
+  xmlpp::Node::NodeSet found;
+  for (auto node : nodes)
+    found.push_back(node);
+  assert(found == root_node->find("//b"));
+
+  const xmlpp::Node* const_root = root_node;
+  xmlpp::XPathNodeSet<const xmlpp::Element*> elements(const_root->select("a"));
+  assert(elements.size() == 1 && elements[0]->get_attribute_value2("id") == "1");
+
+  // Nodes that are not elements are not converted to elements.
+  const xmlpp::XPathNodeSet<const xmlpp::Element*> mixed(const_root->select("//b[@id='4'] | //text()"));
+  assert(mixed.size() == 2 && mixed[0] && !mixed[1]);
+  const xmlpp::XPathNodeSet<xmlpp::ElementRef> mixed_refs(const_root->select("//b[@id='4']/node()"));
+  assert(mixed_refs.size() == 1 && !mixed_refs[0]);
+
+  // A node-set can't be moved to a value type that gives write access,
+  // from one that does not.
+  static_assert(std::is_constructible_v<xmlpp::XPathNodeSet<const xmlpp::Node*>,
+    xmlpp::XPathNodeSet<xmlpp::Element*>&&>);
+  static_assert(std::is_constructible_v<xmlpp::XPathNodeSet<xmlpp::NodeRef>,
+    xmlpp::XPathNodeSet<xmlpp::Node*>&&>);
+  static_assert(!std::is_constructible_v<xmlpp::XPathNodeSet<xmlpp::Node*>,
+    xmlpp::XPathNodeSet<const xmlpp::Node*>&&>);
+  static_assert(!std::is_constructible_v<xmlpp::XPathNodeSet<xmlpp::Element*>,
+    xmlpp::XPathNodeSet<xmlpp::ElementRef>&&>);
+
+  // Moving.
+  auto moved = std::move(nodes);
+  assert(moved.size() == 2);
+  assert(nodes.empty() && !nodes.cobj());
+  nodes = std::move(moved);
+  assert(nodes.size() == 2);
+
+  try
+  {
+    root_node->select("count(//b)");
+    assert(false);
+  }
+  catch (const xmlpp::internal_error&)
+  {
+  }
+  try
+  {
+    root_node->select("//b[");
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+const char* const input =
+  "<feed xmlns:p=\"urn:p\">"
+  "<entry type=\"x\"><id>1</id><p:id>2</p:id></entry>"
+  "<entry type=\"y\"><id>3</id><sub><id>4</id></sub></entry>"
+  "</feed>";
+
+// Collects the text of the elements that match the patterns.
+class PatternParser : public xmlpp::SaxViewParser
+{
+public:
+  PatternParser()
+  : type_(intern("type"))
+  {
+  }
+
+  std::vector<std::string> matches;
+
+protected:
+  void on_pattern_match(std::size_t pattern_index, const QName& name,
+    const NsAttributeList& attributes) override
+  {
+    matches.push_back(std::to_string(pattern_index) + ":" + std::string(name.local_name.view()));
+    const auto type = attributes.find(type_);
+    if (type != attributes.end())
+      matches.back() += "[" + std::string((*type).value) + "]";
+    capture_ = name.local_name.view() == "id";
+  }
+
+  void on_characters(const xmlpp::ustring& characters) override
+  {
+    if (capture_)
+      matches.back() += "=" + characters;
+  }
+
+  void on_end_element(const xmlpp::ustring& /* name */) override
+  {
+    capture_ = false;
+  }
+
+private:
+  const InternedName type_;
+  // Whether the text of an id element is expected.
+  bool capture_ = false;
+};
+} // anonymous namespace
+
+int main()
+{
+  const xmlpp::Node::PrefixNsMap namespaces = { { "q", "urn:p" } };
+
+  // Invalid patterns.
+  try
+  {
+    xmlpp::XPathPattern pattern("/feed/entry[@type='x']/id");
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+  // Whitespace must not join two names.
+  try
+  {
+    xmlpp::XPathPattern pattern("/feed entry");
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  // Matching nodes in a tree.
+  {
+    xmlpp::DomParser parser;
+    parser.parse_memory(input);
+    auto root = parser.get_document()->get_root_node();
+    const xmlpp::XPathPattern pattern("/feed/entry/id");
+    assert(pattern.get_pattern() == "/feed/entry/id");
+    assert(!pattern.matches(root));
+    assert(!pattern.matches(static_cast<const xmlpp::Node*>(nullptr)));
+    assert(pattern.matches(root->find_first("entry/id")));
+    assert(!pattern.matches(root->find_first("//sub/id")));
+    assert(xmlpp::XPathPattern("//id").matches(xmlpp::NodeRef(root->find_first("//sub/id"))));
+    assert(xmlpp::XPathPattern("q:id", namespaces).matches(root->find_first("//*[local-name() = 'id'][2]")));
+    // Whitespace is ignored.
+    const xmlpp::XPathPattern spaced(" /feed/entry/id |\n//sub/id ");
+    assert(spaced.get_pattern() == " /feed/entry/id |\n//sub/id ");
+    assert(spaced.matches(root->find_first("entry/id")));
+    assert(spaced.matches(root->find_first("//sub/id")));
+    assert(xmlpp::XPathPattern("/ feed / entry / q : id", namespaces).matches(
+      root->find_first("entry/*[local-name() = 'id'][2]")));
+  }
+
+  // SaxParser.
+  {
+    const xmlpp::XPathPattern ids("/feed/entry/id");
+    const xmlpp::XPathPattern entries("entry | //q:id", namespaces);
+    PatternParser parser;
+    assert(parser.add_pattern(ids) == 0);
+    assert(parser.add_pattern(entries) == 1);
+    // The callbacks for the elements are unchanged.
+    assert(!parser.get_namespace_callbacks());
+    parser.parse_memory(input);
+    const std::vector<std::string> expected = {
+      "1:entry[x]", "0:id=1", "1:id=2", "1:entry[y]", "0:id=3" };
+    assert(parser.matches == expected);
+
+    // A second parse starts from the beginning.
+    parser.matches.clear();
+    parser.parse_memory(input);
+    assert(parser.matches == expected);
+
+    parser.matches.clear();
+    parser.clear_patterns();
+    parser.add_pattern(xmlpp::XPathPattern("//id"));
+    parser.clear_patterns();
+    parser.parse_memory(input);
+    assert(parser.matches.empty());
+  }
+
+  // TextReader.
+  {
+    const std::string data(input);
+    xmlpp::TextReader reader((const unsigned char*)data.c_str(), data.size());
+    const xmlpp::XPathPattern pattern("//id");
+    std::string ids;
+    while (reader.read_to_match(pattern))
+    {
+      assert(reader.matches(pattern));
+      ids += reader.read_string2().value_or("");
+    }
+    assert(ids == "134");
+
+    xmlpp::TextReader reader2((const unsigned char*)data.c_str(), data.size());
+    const xmlpp::XPathPattern type_x("/feed/entry");
+    std::string types;
+    while (reader2.read_to_match(type_x))
+      types += reader2.get_attribute2("type").value_or("");
+    assert(types == "xy");
+  }
+
+  return EXIT_SUCCESS;
+}
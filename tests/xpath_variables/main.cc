@@ -0,0 +1,106 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+
+#include <cassert>
+#include <cstdlib>
+
+namespace
+{
+const char* const input =
+  "<orders>"
+  "<order id=\"a'1\" total=\"10\"/>"
+  "<order id=\"b&quot;2\" total=\"20\" paid=\"yes\"/>"
+  "<order id=\"c3\" total=\"30\"/>"
+  "</orders>";
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::DomParser parser;
+  parser.parse_memory(input);
+  const xmlpp::Node* root = parser.get_document()->get_root_node();
+
+  xmlpp::XPathContext context;
+  assert(context.get_variable_type("id") == xmlpp::XPathResultType::UNDEFINED);
+
+  // An undefined variable.
+  const xmlpp::XPathExpression by_id("order[@id = $id]");
+  try
+  {
+    root->find(by_id, context);
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  // String values, with quotes that would need escaping in an expression string.
+  for (const char* id : { "a'1", "b\"2", "c3" })
+  {
+    context.set_variable_string("id", id);
+    const auto set = root->find(by_id, context);
+    assert(set.size() == 1);
+    assert(static_cast<const xmlpp::Element*>(set[0])->get_attribute_value2("id") == id);
+  }
+  assert(context.get_variable_type("id") == xmlpp::XPathResultType::STRING);
+  context.set_variable_string("id", "nosuchid");
+  assert(root->find(by_id, context).empty());
+
+  // Number values.
+  const xmlpp::XPathExpression above("count(order[@total > $min])");
+  context.set_variable_number("min", 15);
+  assert(root->eval_to_number(above, context) == 2.0);
+  context.set_variable_number("min", 25.5);
+  assert(root->eval_to_number(above, context) == 1.0);
+  assert(context.get_variable_type("min") == xmlpp::XPathResultType::NUMBER);
+
+  // Boolean values.
+  const xmlpp::XPathExpression paid("order[boolean(@paid) = $paid]/@id");
+  context.set_variable_boolean("paid", true);
+  assert(root->eval_to_string(paid, context) == "b\"2");
+  context.set_variable_boolean("paid", false);
+  assert(root->eval_to_string(paid, context) == "a'1");
+  assert(context.get_variable_type("paid") == xmlpp::XPathResultType::BOOLEAN);
+
+  // Node-set values, in document order.
+  const auto orders = root->find("order");
+  context.set_variable_nodeset("orders", { orders[2], orders[0], orders[2] });
+  assert(context.get_variable_type("orders") == xmlpp::XPathResultType::NODESET);
+  assert(root->eval_to_number(xmlpp::XPathExpression("count($orders)"), context) == 2.0);
+  assert(root->eval_to_string(xmlpp::XPathExpression("$orders[1]/@id"), context) == "a'1");
+  const auto var = root->eval_xpath(xmlpp::XPathExpression("$orders[@total > $min]"), context);
+  const auto& set = std::get<xmlpp::Node::const_NodeSet>(var);
+  assert(set.size() == 1 && set[0] == orders[2]);
+
+  // Remove variables.
+  context.unset_variable("id");
+  assert(context.get_variable_type("id") == xmlpp::XPathResultType::UNDEFINED);
+  assert(context.get_variable_type("min") == xmlpp::XPathResultType::NUMBER);
+  context.unset_all_variables();
+  assert(context.get_variable_type("min") == xmlpp::XPathResultType::UNDEFINED);
+  try
+  {
+    root->eval_to_number(above, context);
+    assert(false);
+  }
+  catch (const xmlpp::exception&)
+  {
+  }
+
+  return EXIT_SUCCESS;
+}
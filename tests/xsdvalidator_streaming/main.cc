@@ -0,0 +1,176 @@
+/* Copyright (C) 2026  The libxml++ development team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <libxml++/libxml++.h>
+#include <libxml/xmlerror.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+const char schema_text[] =
+  "<xs:schema xmlns:xs='http://www.w3.org/2001/XMLSchema'>"
+  "<xs:element name='list'><xs:complexType><xs:sequence>"
+  "<xs:element name='item' type='xs:int' maxOccurs='unbounded'/>"
+  "</xs:sequence></xs:complexType></xs:element>"
+  "</xs:schema>";
+
+const char valid_doc[] = "<list><item>1</item><item>2</item></list>";
+const char invalid_doc[] = "<list><item>1</item><item>two</item></list>";
+const char malformed_doc[] = "<list><item>1</item></lst>";
+
+// Messages that libxml2 prints, instead of passing them to libxml++.
+int n_generic_errors = 0;
+
+extern "C" void generic_error(void* /* ctx */, const char* /* msg */, ...)
+{
+  ++n_generic_errors;
+}
+
+class CountingParser : public xmlpp::SaxParser
+{
+public:
+  int elements = 0;
+  std::string text;
+  std::string errors;
+  std::string fatal_errors;
+
+protected:
+  void on_start_element(const xmlpp::ustring&, const AttributeList&) override
+  {
+    ++elements;
+  }
+
+  void on_characters(const xmlpp::ustring& characters) override
+  {
+    text += characters;
+  }
+
+  void on_error(const xmlpp::ustring& message) override
+  {
+    errors += message;
+  }
+
+  void on_fatal_error(const xmlpp::ustring& message) override
+  {
+    fatal_errors += message;
+  }
+};
+
+template <typename Exception, typename F>
+bool throws(F f, std::string* message = nullptr)
+{
+  try
+  {
+    f();
+  }
+  catch (const Exception& ex)
+  {
+    if (message)
+      *message = ex.what();
+    return true;
+  }
+  return false;
+}
+} // anonymous namespace
+
+int main()
+{
+  xmlpp::XsdValidator validator;
+  validator.parse_memory(schema_text);
+  xmlSetGenericErrorFunc(nullptr, generic_error);
+
+  // Validation while parsing with a SaxParser.
+  {
+    CountingParser parser;
+    assert(!parser.get_xsd_validator());
+    parser.set_xsd_validator(&validator);
+    assert(parser.get_xsd_validator() == &validator);
+
+    // The parser's callbacks are called as without validation.
+    parser.parse_memory(valid_doc);
+    assert(parser.elements == 3);
+    assert(parser.text == "12");
+
+    std::string message;
+    assert(throws<xmlpp::validity_error>([&]{ parser.parse_memory(invalid_doc); }, &message));
+    assert(message.find("Document failed XSD schema validation.\nElement 'item'") == 0);
+
+    // The parser's errors are passed to the parser, also while validating.
+    assert(throws<xmlpp::parse_error>([&]{ parser.parse_memory(malformed_doc); }));
+    assert(parser.fatal_errors.find("Opening and ending tag mismatch") != std::string::npos);
+    assert(parser.errors.empty());
+    assert(n_generic_errors == 0);
+
+    // The default on_fatal_error() throws.
+    xmlpp::SaxParser default_parser;
+    default_parser.set_xsd_validator(&validator);
+    assert(throws<xmlpp::parse_error>([&]{ default_parser.parse_memory(malformed_doc); }, &message));
+    assert(message.find("Fatal error: Opening and ending tag mismatch") == 0);
+
+    // The parser can be reused after a failed validation.
+    parser.elements = 0;
+    parser.parse_memory(valid_doc);
+    assert(parser.elements == 3);
+
+    // Chunk-wise parsing. The result is known when the parse is finished.
+    parser.parse_chunk("<list><item>1</item>");
+    parser.parse_chunk("<item>x</item></list>");
+    assert(throws<xmlpp::validity_error>([&]{ parser.finish_chunk_parsing(); }));
+
+    parser.parse_chunk("<list><item>1</item>");
+    parser.parse_chunk("<item>2</item></list>");
+    parser.finish_chunk_parsing();
+
+    // Stop validating.
+    parser.set_xsd_validator(nullptr);
+    parser.parse_memory(invalid_doc);
+  }
+
+  // The validator can still validate documents.
+  {
+    xmlpp::DomParser parser;
+    parser.parse_memory(invalid_doc);
+    assert(throws<xmlpp::validity_error>([&]{ validator.validate(parser.get_document()); }));
+  }
+
+  // Validation while reading with a TextReader.
+  {
+    xmlpp::TextReader reader((const unsigned char*)valid_doc, sizeof(valid_doc) - 1);
+    reader.set_schema(validator.get_schema());
+    int elements = 0;
+    while (reader.read())
+      if (reader.get_node_type() == xmlpp::TextReader::NodeType::Element)
+        ++elements;
+    assert(elements == 3);
+    assert(reader.is_valid());
+  }
+  {
+    xmlpp::TextReader reader((const unsigned char*)invalid_doc, sizeof(invalid_doc) - 1);
+    reader.set_schema(validator.get_schema());
+    // get_name2() throws the validity error.
+    assert(throws<xmlpp::validity_error>([&]{ while (reader.read()) reader.get_name2(); }));
+    assert(!reader.is_valid());
+
+    // Too late to set a schema.
+    assert(throws<xmlpp::internal_error>([&]{ reader.set_schema(validator.get_schema()); }));
+  }
+
+  return EXIT_SUCCESS;
+}